@@ -13,5 +13,5 @@ class SOULSTRIKE_API UArcherRLComponent : public URLComponent
 	GENERATED_BODY()
 
 protected:
-	virtual float CalculateReward() override;
+	virtual FEliteRewardFunction GetRewardFunction() const override;
 };
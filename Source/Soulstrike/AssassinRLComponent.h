@@ -13,7 +13,6 @@ class SOULSTRIKE_API UAssassinRLComponent : public URLComponent
 	GENERATED_BODY()
 
 protected:
-	virtual float CalculateReward() override;
-	virtual void UpdatePoisons(float DeltaTime) override;
-	virtual void OnAttackWindupComplete() override;
+	virtual FEliteRewardFunction GetRewardFunction() const override;
+	virtual void OnAttackWindupComplete(const FAttackWindupResult& Result) override;
 };
@@ -6,9 +6,13 @@
 #include <Kismet/GameplayStatics.h>
 
 #include "EliteEnemy.h"
+#include "EliteArchetypeRegistry.h"
 #include "Util/Spawn.h"
 #include "Util/LoadBP.h"
 #include "SwarmAIController.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeStats.h"
+#include "SoulstrikeTrace.h"
 
 
 // Sets default values
@@ -26,7 +30,7 @@ void ADirector::BeginPlay()
 	PlayerCharacter = Cast<ACharacterBase>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
 	if (!PlayerCharacter.IsValid())
 	{
-		UE_LOG(LogTemp, Warning, TEXT("Player character not found in LevelScriptActorBase."));
+		UE_LOG(LogSoulstrikeDirector, Warning, TEXT("Player character not found in LevelScriptActorBase."));
 	}
 
 	LoadBP::LoadClass("/Game/ThirdPersonBP/Blueprints/SwarmAI/BP_SwarmEnemy.BP_SwarmEnemy_C", EnemyActorClass);
@@ -39,21 +43,47 @@ void ADirector::BeginPlay()
 	DirectorDelegate.BindUObject(this, &ADirector::TickDirector);
 	GetWorldTimerManager().SetTimer(DirectorTimerHandle, DirectorDelegate, 1.0f, true);
 
-	StartTime = FPlatformTime::Seconds();
+	StartTime = GetWorld()->GetTimeSeconds();
+	SpawnCredits = Config.InitialSpawnCredits;
+}
+
+FDirectorConfig FDirectorConfig::MakeBotTraining()
+{
+	FDirectorConfig BotConfig;
+	BotConfig.SpawnAttemptInterval = 3;
+	BotConfig.BaseSpawnChance = 70;
+	BotConfig.BaseEliteChance = 75;
+	BotConfig.InitialSpawnCredits = 100;
+	BotConfig.BaseCreditAmountToReceive = 25;
+	BotConfig.MaxSwarmEnemies = 20;
+	BotConfig.SwarmSpawnRadius = 4000.f;
+	BotConfig.SwarmSpawnMinDistance = 2000.f;
+	BotConfig.EliteSpawnRadius = 2500.f;
+	BotConfig.EliteSpawnMinDistance = 1500.f;
+	return BotConfig;
+}
+
+void ADirector::ApplyConfig(const FDirectorConfig& InConfig)
+{
+	Config = InConfig;
+	SpawnCredits = Config.InitialSpawnCredits;
+	TickNum = 0;
+	SpawnChanceBonus = 0;
+	SpawnEliteChanceBonus = 0;
 }
 
 void ADirector::LoadEliteClasses()
 {
-	auto LoadEliteClass = [](std::string BpClass, TSubclassOf<AActor>& Class) {
-		LoadBP::LoadClass("/Game/ThirdPersonBP/Blueprints/EliteAI/" + BpClass + "." + BpClass + "_C", Class);
-	};
+	UEliteArchetypeRegistry* Registry = UEliteArchetypeRegistry::Get(GetWorld());
+	if (!Registry)
+		return;
 
-	for (auto& Entry : EliteClassMap)
+	for (const FEliteArchetype& Archetype : Registry->Archetypes)
 	{
-		LoadEliteClass(Entry.Name, *Entry.ClassPtr);
+		TSubclassOf<AActor> EliteClass = Archetype.PawnClass.LoadSynchronous();
 
-		if (*Entry.ClassPtr)       // Only add valid classes
-			EliteClasses.Add(*Entry.ClassPtr);
+		if (EliteClass)       // Only add valid classes
+			EliteClasses.Add(EliteClass);
 	}
 }
 
@@ -66,15 +96,29 @@ void ADirector::Tick(float DeltaTime)
 
 void ADirector::TickDirector()
 {
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_TickDirector);
+	SOULSTRIKE_AI_STAGE(TickDirector);
+	SOULSTRIKE_TRACE_SCOPE(SoulstrikeAI_TickDirector);
+
+	if (bSpawningPaused)
+		return;
+
+	if (!PlayerCharacter.IsValid())
+	{
+		// Try to find player again
+		PlayerCharacter = Cast<ACharacterBase>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
+		return;
+	}
+
 	ReceiveSpawnCredits();
-	int BaseChance = 50 + PlayerCharacter->Level;
+	int BaseChance = Config.BaseSpawnChance + PlayerCharacter->Level;
 
-	// Attempt to spawn enemies every 6 seconds
-	if (TickNum >= 6)
+	// Attempt to spawn enemies every few seconds
+	if (TickNum >= Config.SpawnAttemptInterval)
 	{
 		if (FMath::RandRange(1, 100) <= BaseChance + SpawnChanceBonus)
 		{
-			if (SpawnCredits >= EliteSpawnCost && FMath::RandRange(1, 100) <= 50 + SpawnEliteChanceBonus)
+			if (SpawnCredits >= Config.EliteSpawnCost && FMath::RandRange(1, 100) <= Config.BaseEliteChance + SpawnEliteChanceBonus)
 			{
 				SpawnEliteEnemies();
 				SpawnEliteChanceBonus = 0;
@@ -90,12 +134,13 @@ void ADirector::TickDirector()
 		{
 			// Each failed attempt will increase the chance of spawning next time by 25%
 			SpawnChanceBonus += 25;
+			SOULSTRIKE_TRACE_EVENT(DirectorSpawn, ESoulstrikeSpawnDecision::Skipped, 0, SpawnCredits);
 		}
 
 		TickNum = 0;
 	}
 
-	UE_LOG(LogTemp, Display, TEXT("Current credit count: %d"), SpawnCredits);
+	UE_LOG(LogSoulstrikeDirector, Verbose, TEXT("Current credit count: %d"), SpawnCredits);
 	TickNum += 1;
 }
 
@@ -103,21 +148,28 @@ void ADirector::ReceiveSpawnCredits()
 {
 	float Multiplier = 1.f;
 
-	Multiplier += (FPlatformTime::Seconds() - StartTime) / 60.f;
+	Multiplier += (GetWorld()->GetTimeSeconds() - StartTime) / 60.f;
 	Multiplier *= PlayerCharacter->CurrentHP / PlayerCharacter->MaxHP;
 
-	Multiplier *= (1 - 0.16f * CountActors(AEliteEnemy::StaticClass()));
+	const int32 NumElites = CountActors(AEliteEnemy::StaticClass());
+	Multiplier *= (1 - 0.16f * NumElites);
+
+	const int32 NumSwarm = CountActors(EnemyActorClass);
+	Multiplier *= FMath::Min(1.f, 20.f / NumSwarm);
+	UE_LOG(LogSoulstrikeDirector, Verbose, TEXT("Current credit multiplier: %f"), Multiplier);
 
-	Multiplier *= FMath::Min(1.f, 20.f / CountActors(EnemyActorClass));
-	UE_LOG(LogTemp, Display, TEXT("Current credit multiplier: %f"), Multiplier);
+	SpawnCredits += FMath::RoundToInt(Config.BaseCreditAmountToReceive * Multiplier);
 
-	SpawnCredits += FMath::RoundToInt(BaseCreditAmountToReceive * Multiplier);
+	CSV_CUSTOM_STAT(SoulstrikeDirector, SpawnCredits, SpawnCredits, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SoulstrikeDirector, CreditMultiplier, Multiplier, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SoulstrikeDirector, LiveElites, NumElites, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SoulstrikeDirector, LiveSwarm, NumSwarm, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SoulstrikeDirector, SwarmPacksTracked, ASwarmAIController::GetNumTrackedSwarmPacks(), ECsvCustomStatOp::Set);
 }
 
 void ADirector::SpawnSwarmEnemies()
 {
-	int MaxSwarmEnemyCount = 40;
-	if (CountActors(EnemyActorClass) >= MaxSwarmEnemyCount)
+	if (CountActors(EnemyActorClass) >= Config.MaxSwarmEnemies)
 	{
 		return;
 	}
@@ -132,13 +184,12 @@ void ADirector::SpawnSwarmEnemies()
 		15;
 
 	int EnemiesToSpawn = FMath::RandRange(MinEnemyCount, MaxEnemyCount);
-	EnemiesToSpawn = FMath::Min(EnemiesToSpawn, SpawnCredits / EnemySpawnCost);
+	EnemiesToSpawn = FMath::Min(EnemiesToSpawn, SpawnCredits / Config.EnemySpawnCost);
 
-	UE_LOG(LogTemp, Display, TEXT("Spawning %d enemies."), EnemiesToSpawn);
-	float SpawnRadius = 6000.f;
+	UE_LOG(LogSoulstrikeDirector, Log, TEXT("Spawning %d enemies."), EnemiesToSpawn);
 	FVector PlayerLocation = PlayerCharacter->GetActorLocation();
 
-	FVector SpawnLocation = ChooseEnemySpawnLocation(PlayerLocation, SpawnRadius, 3000.f);
+	FVector SpawnLocation = ChooseEnemySpawnLocation(PlayerLocation, Config.SwarmSpawnRadius, Config.SwarmSpawnMinDistance);
 
 	UWorld* World = GetWorld();
 	FName Path = FName("Enemies/SwarmEnemies/Pack_" + FString::FromInt(SwarmPackNum++));
@@ -161,7 +212,8 @@ void ADirector::SpawnSwarmEnemies()
 				Controller->RegisterSwarmEnemy(PawnEnemy, SwarmId);
 		}
 	}
-	SpawnCredits -= EnemiesToSpawn * EnemySpawnCost;
+	SpawnCredits -= EnemiesToSpawn * Config.EnemySpawnCost;
+	SOULSTRIKE_TRACE_EVENT(DirectorSpawn, ESoulstrikeSpawnDecision::Swarm, EnemiesToSpawn, SpawnCredits);
 }
 
 void ADirector::SpawnEliteEnemies()
@@ -182,7 +234,7 @@ void ADirector::SpawnEliteEnemies()
 
 	TSubclassOf<AActor> SelectedEliteClass = AvailableEliteClasses[FMath::RandRange(0, AvailableEliteClasses.Num() - 1)];
 	FVector PlayerLocation = PlayerCharacter->GetActorLocation();
-	FVector SpawnLocation = ChooseEnemySpawnLocation(PlayerLocation, 3000.f, 2000.f);
+	FVector SpawnLocation = ChooseEnemySpawnLocation(PlayerLocation, Config.EliteSpawnRadius, Config.EliteSpawnMinDistance);
 
 	UWorld* World = GetWorld();
 
@@ -194,7 +246,8 @@ void ADirector::SpawnEliteEnemies()
 		NewElite->SetFolderPath("Enemies/EliteEnemies");
 #endif
 	}
-	SpawnCredits -= EliteSpawnCost;
+	SpawnCredits -= Config.EliteSpawnCost;
+	SOULSTRIKE_TRACE_EVENT(DirectorSpawn, ESoulstrikeSpawnDecision::Elite, NewElite ? 1 : 0, SpawnCredits);
 }
 
 FVector ADirector::ChooseEnemySpawnLocation(FVector Origin, float Radius, float MinDistance)
@@ -241,6 +294,6 @@ int ADirector::CountActors(UClass* Class)
 	{
 		Count++;
 	}
-	UE_LOG(LogTemp, Display, TEXT("Counted %d actors of class %s"), Count, *Class->GetName());
+	UE_LOG(LogSoulstrikeDirector, VeryVerbose, TEXT("Counted %d actors of class %s"), Count, *Class->GetName());
 	return Count;
 }
\ No newline at end of file
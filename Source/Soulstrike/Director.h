@@ -2,14 +2,68 @@
 
 #pragma once
 
-#include <string>
-
 #include "CharacterBase.h"
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Director.generated.h"
 
+/**
+ * Spawn pacing for the Director. Defaults are the shipping game's pacing.
+ */
+USTRUCT(BlueprintType)
+struct FDirectorConfig
+{
+	GENERATED_BODY()
+
+	/** Director ticks (seconds) between spawn attempts */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director", meta = (ClampMin = "1"))
+	int32 SpawnAttemptInterval = 6;
+
+	/** Percent chance a spawn attempt succeeds, plus the player's level */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	int32 BaseSpawnChance = 50;
+
+	/** Percent chance a successful attempt spawns an elite when it can be afforded */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	int32 BaseEliteChance = 50;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	int32 InitialSpawnCredits = 50;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	int32 BaseCreditAmountToReceive = 15;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	int32 EnemySpawnCost = 20;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	int32 EliteSpawnCost = 100;
+
+	/** No swarm packs are added while this many swarm enemies are alive */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	int32 MaxSwarmEnemies = 40;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	float SwarmSpawnRadius = 6000.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	float SwarmSpawnMinDistance = 3000.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	float EliteSpawnRadius = 3000.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	float EliteSpawnMinDistance = 2000.f;
+
+	/**
+	 * Pacing for headless training against the player bot: elites come sooner and more often,
+	 * swarm packs are smaller and everything spawns closer, so more of the simulated time is
+	 * spent in elite fights
+	 */
+	static FDirectorConfig MakeBotTraining();
+};
+
 UCLASS(Blueprintable)
 class SOULSTRIKE_API ADirector : public AActor
 {
@@ -28,6 +82,15 @@ public:
 	virtual void Tick(float DeltaTime) override;
 	void TickDirector();
 
+	/** Stop (or resume) earning credits and spawning - benchmarks place their own enemies */
+	void SetSpawningPaused(bool bPaused) { bSpawningPaused = bPaused; }
+
+	/** Replace the spawn pacing (and restart the credit pool from its initial credits) */
+	void ApplyConfig(const FDirectorConfig& InConfig);
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Director")
+	FDirectorConfig Config;
+
 private:
 	void LoadEliteClasses();
 
@@ -43,47 +106,19 @@ private:
 	UPROPERTY()
 	TSubclassOf<AActor> EnemyActorClass;
 
+	/** Elite pawn classes from the archetype registry */
 	UPROPERTY()
-	TSubclassOf<AActor> EliteArcherActorClass;
-
-	UPROPERTY()
-	TSubclassOf<AActor> EliteAssassinActorClass;
-
-	UPROPERTY()
-	TSubclassOf<AActor> EliteGiantActorClass;
-
-	UPROPERTY()
-	TSubclassOf<AActor> EliteHealerActorClass;
-
-	UPROPERTY()
-	TSubclassOf<AActor> ElitePaladinActorClass;
-
-	struct FEliteClassEntry
-	{
-		const std::string Name;
-		TSubclassOf<AActor>* ClassPtr;
-	};
-
-	TArray<FEliteClassEntry> EliteClassMap = {
-		{ "BP_EliteArcher",   &EliteArcherActorClass },
-		{ "BP_EliteAssassin", &EliteAssassinActorClass },
-		{ "BP_EliteGiant",    &EliteGiantActorClass },
-		{ "BP_EliteHealer",   &EliteHealerActorClass },
-		{ "BP_ElitePaladin",  &ElitePaladinActorClass }
-	};
 	TArray<TSubclassOf<AActor>> EliteClasses;
 
+	// World time (not wall time) so the credit ramp follows time-dilated training runs
 	double StartTime;
 	int32 TickNum = 0;
 	int32 SpawnChanceBonus = 0;
 	int32 SpawnEliteChanceBonus = 0;
 
 	int32 SpawnCredits = 50;
-	int32 BaseCreditAmountToReceive = 15;
 
 	int32 SwarmPackNum = 0;
 
-	// Enemy spawn costs
-	int32 EnemySpawnCost = 20;
-	int32 EliteSpawnCost = 100;
+	bool bSpawningPaused = false;
 };
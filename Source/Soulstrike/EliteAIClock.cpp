@@ -0,0 +1,93 @@
+#include "EliteAIClock.h"
+#include "SoulstrikeLog.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+static float GEliteAIFixedRate = 0.0f;
+static FAutoConsoleVariableRef CVarEliteAIFixedRate(
+	TEXT("Soulstrike.AI.FixedRate"),
+	GEliteAIFixedRate,
+	TEXT("AI simulation steps per second, independent of the frame rate (0 = one step per frame)."));
+
+static int32 GEliteAIFixedRateMaxSteps = 4;
+static FAutoConsoleVariableRef CVarEliteAIFixedRateMaxSteps(
+	TEXT("Soulstrike.AI.FixedRateMaxSteps"),
+	GEliteAIFixedRateMaxSteps,
+	TEXT("Most fixed AI steps run in one frame; after a longer hitch the rest are dropped instead of caught up."));
+
+UEliteAIClock* UEliteAIClock::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UEliteAIClock>() : nullptr;
+}
+
+bool UEliteAIClock::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+		return false;
+
+	// Same worlds as the AI services it drives
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+void UEliteAIClock::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Benchmarks pin the rate from the command line so runs compare across machines
+	FParse::Value(FCommandLine::Get(), TEXT("SoulstrikeAIFixedRate="), GEliteAIFixedRate);
+
+	TickStartHandle = FWorldDelegates::OnWorldTickStart.AddUObject(this, &UEliteAIClock::OnWorldTickStart);
+}
+
+void UEliteAIClock::Deinitialize()
+{
+	FWorldDelegates::OnWorldTickStart.Remove(TickStartHandle);
+
+	if (DroppedSteps > 0)
+	{
+		UE_LOG(LogSoulstrikeAI, Log, TEXT("EliteAIClock: %llu fixed steps run, %lld dropped after hitches"), StepCount, DroppedSteps);
+	}
+
+	Super::Deinitialize();
+}
+
+void UEliteAIClock::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds)
+{
+	if (World != GetWorld())
+		return;
+
+	// Tickables (the RL scheduler) don't tick while paused; swarm movement follows suit
+	if (World->IsPaused())
+	{
+		StepsThisFrame = 0;
+		return;
+	}
+
+	if (GEliteAIFixedRate <= 0.0f)
+	{
+		StepSeconds = 0.0f;
+		Accumulator = 0.0;
+		StepsThisFrame = 1;
+		++StepCount;
+		return;
+	}
+
+	StepSeconds = 1.0f / GEliteAIFixedRate;
+	Accumulator += DeltaSeconds;
+
+	StepsThisFrame = FMath::FloorToInt(Accumulator / StepSeconds);
+	Accumulator -= StepsThisFrame * static_cast<double>(StepSeconds);
+
+	// Catching up after a hitch would make the next frame even longer
+	const int32 MaxSteps = FMath::Max(1, GEliteAIFixedRateMaxSteps);
+	if (StepsThisFrame > MaxSteps)
+	{
+		DroppedSteps += StepsThisFrame - MaxSteps;
+		StepsThisFrame = MaxSteps;
+	}
+
+	StepCount += StepsThisFrame;
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineBaseTypes.h"
+#include "EliteAIClock.generated.h"
+
+/**
+ * Elite AI Clock - optional fixed-rate clock for AI simulation.
+ * With Soulstrike.AI.FixedRate (or -SoulstrikeAIFixedRate=) at e.g. 20, elite RL steps and swarm
+ * steering advance in fixed 1/20 s steps however fast frames come: a frame runs zero or more AI
+ * steps, and movement in between follows the last steps' steering (blended by GetInterpolationAlpha).
+ * At 0 the clock is off and every frame is one AI step of the frame's DeltaTime, as before.
+ *
+ * The clock advances at the start of the world tick, so actors and subsystems ticking that frame
+ * all see the same step count.
+ */
+UCLASS()
+class SOULSTRIKE_API UEliteAIClock : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the clock for a world (null for non-game worlds) */
+	static UEliteAIClock* Get(const UWorld* World);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	bool IsFixed() const { return StepSeconds > 0.0f; }
+
+	/** AI steps to run this frame (always 1 while the clock is off, 0 while paused) */
+	int32 GetStepsThisFrame() const { return StepsThisFrame; }
+
+	/** DeltaTime of one AI step */
+	float GetStepDeltaTime(float FrameDeltaTime) const { return IsFixed() ? StepSeconds : FrameDeltaTime; }
+
+	/** How far the frame is into the next AI step [0,1] (1 while the clock is off) */
+	float GetInterpolationAlpha() const { return IsFixed() ? static_cast<float>(Accumulator / StepSeconds) : 1.0f; }
+
+	/** AI steps run since the world started */
+	uint64 GetStepCount() const { return StepCount; }
+
+private:
+	void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	FDelegateHandle TickStartHandle;
+
+	float StepSeconds = 0.0f;
+	double Accumulator = 0.0;
+	int32 StepsThisFrame = 0;
+	uint64 StepCount = 0;
+	int64 DroppedSteps = 0;
+};
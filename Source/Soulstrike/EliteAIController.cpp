@@ -1,26 +1,20 @@
 #include "EliteAIController.h"
+#include "SoulstrikeLog.h"
 #include "RLComponent.h"
-#include "ArcherRLComponent.h"
-#include "AssassinRLComponent.h"
-#include "PaladinRLComponent.h"
-#include "GiantRLComponent.h"
-#include "HealerRLComponent.h"
-#include "EliteArcher.h"
-#include "EliteAssassin.h"
-#include "ElitePaladin.h"
-#include "EliteGiant.h"
-#include "EliteHealer.h"
+#include "EliteArchetypeComponent.h"
+#include "EliteSignificanceManager.h"
+#include "EliteRLScheduler.h"
 
 AEliteAIController::AEliteAIController()
 {
-	PrimaryActorTick.bCanEverTick = true; // for packaged compatibility
+	// No actor tick - UEliteRLScheduler steps the RL component and updates control rotation
+	PrimaryActorTick.bCanEverTick = false;
 
 	// Don't create RLComponent here - will be created dynamically based on pawn type
 	RLComponent = nullptr;
 
 	// Default: run RL every tick (can be changed for performance)
 	RLTickInterval = 0.0f;
-	RLTickAccumulator = 0.0f;
 
 	// Debug mode off by default
 	bEnableDebugMode = false;
@@ -42,47 +36,38 @@ void AEliteAIController::OnPossess(APawn* InPawn)
 {
 	Super::OnPossess(InPawn);
 
-	// If RLComponent wasn't set in Blueprint, create the correct one based on pawn type
-	if (!RLComponent && InPawn)
+	// Resolve the pawn's archetype once and cache it on the pawn
+	UEliteArchetypeComponent* ArchetypeComponent = UEliteArchetypeComponent::FindOrCreate(InPawn);
+	if (!ArchetypeComponent)
+		return;
+
+	const FEliteArchetype& Archetype = ArchetypeComponent->GetArchetype();
+
+	// If RLComponent wasn't set in Blueprint, create the one registered for this archetype
+	if (!RLComponent)
 	{
-		// Determine which RL component to create based on pawn name (works with BP_Enemy parent)
-		FString PawnName = InPawn->GetName();
-		
-		if (PawnName.Contains("Archer"))
-		{
-			RLComponent = NewObject<UArcherRLComponent>(this, UArcherRLComponent::StaticClass(), TEXT("ArcherRLComponent"));
-		}
-		else if (PawnName.Contains("Assassin"))
-		{
-			RLComponent = NewObject<UAssassinRLComponent>(this, UAssassinRLComponent::StaticClass(), TEXT("AssassinRLComponent"));
-		}
-		else if (PawnName.Contains("Paladin"))
-		{
-			RLComponent = NewObject<UPaladinRLComponent>(this, UPaladinRLComponent::StaticClass(), TEXT("PaladinRLComponent"));
-		}
-		else if (PawnName.Contains("Giant"))
-		{
-			RLComponent = NewObject<UGiantRLComponent>(this, UGiantRLComponent::StaticClass(), TEXT("GiantRLComponent"));
-		}
-		else if (PawnName.Contains("Healer"))
-		{
-			RLComponent = NewObject<UHealerRLComponent>(this, UHealerRLComponent::StaticClass(), TEXT("HealerRLComponent"));
-		}
-		else
-		{
-			// Fallback to base component
-			RLComponent = NewObject<URLComponent>(this, URLComponent::StaticClass(), TEXT("RLComponent"));
-		}
+		UClass* ComponentClass = Archetype.RLComponentClass ? Archetype.RLComponentClass.Get() : URLComponent::StaticClass();
+		RLComponent = NewObject<URLComponent>(this, ComponentClass, ComponentClass->GetFName());
 
 		// Register the component
 		if (RLComponent)
 		{
 			RLComponent->RegisterComponent();
-			UE_LOG(LogTemp, Log, TEXT("EliteAIController: Created RL component type: %s for %s"), 
-				*RLComponent->GetClass()->GetName(), *PawnName);
+			UE_LOG(LogSoulstrikeAI, Log, TEXT("EliteAIController: Created RL component type: %s for %s"), 
+				*RLComponent->GetClass()->GetName(), *InPawn->GetName());
 		}
 	}
 
+	// Archetype tuning replaces the controller defaults when it asks to
+	if (Archetype.Brain.bOverrideControllerTuning)
+	{
+		LearningRate = Archetype.Brain.LearningRate;
+		DiscountFactor = Archetype.Brain.DiscountFactor;
+		ExplorationRate = Archetype.Brain.ExplorationRate;
+		ExplorationDecayRate = Archetype.Brain.ExplorationDecayRate;
+		ActionPersistenceDuration = Archetype.Brain.ActionPersistenceDuration;
+	}
+
 	if (RLComponent)
 	{
 		// Initial hyperparameter sync only (they remain constant unless designer changes in editor)
@@ -92,19 +77,37 @@ void AEliteAIController::OnPossess(APawn* InPawn)
 		RLComponent->EpsilonDecayRate = ExplorationDecayRate;
 		RLComponent->MinActionDuration = ActionPersistenceDuration;
 		RLComponent->bDebugMode = bEnableDebugMode;
-		RLComponent->Initialize(InPawn);
+		RLComponent->Initialize(InPawn, Archetype);
+	}
+
+	if (UEliteSignificanceManager* SignificanceManager = UEliteSignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->Register(InPawn);
+	}
+
+	if (UEliteRLScheduler* Scheduler = UEliteRLScheduler::Get(GetWorld()))
+	{
+		Scheduler->Register(this, RLComponent);
 	}
 }
 
 void AEliteAIController::OnUnPossess()
 {
+	if (UEliteRLScheduler* Scheduler = UEliteRLScheduler::Get(GetWorld()))
+	{
+		Scheduler->Unregister(this);
+	}
+
+	if (UEliteSignificanceManager* SignificanceManager = UEliteSignificanceManager::Get(GetWorld()))
+	{
+		SignificanceManager->Unregister(GetPawn());
+	}
+
 	Super::OnUnPossess();
 }
 
-void AEliteAIController::Tick(float DeltaTime)
+void AEliteAIController::SyncRLComponent()
 {
-	Super::Tick(DeltaTime);
-
 	if (!RLComponent)
 		return;
 
@@ -115,20 +118,4 @@ void AEliteAIController::Tick(float DeltaTime)
 	{
 		RLComponent->bDebugMode = bEnableDebugMode;
 	}
-
-	// If RLTickInterval is 0, run every tick
-	if (RLTickInterval <= 0.0f)
-	{
-		RLComponent->ExecuteRLStep(DeltaTime);
-	}
-	else
-	{
-		// Accumulate time and run at fixed intervals
-		RLTickAccumulator += DeltaTime;
-		if (RLTickAccumulator >= RLTickInterval)
-		{
-			RLComponent->ExecuteRLStep(RLTickAccumulator);
-			RLTickAccumulator = 0.0f;
-		}
-	}
 }
@@ -8,7 +8,7 @@ class URLComponent;
 
 /**
  * AI Controller for Elite Enemies.
- * Drives the RL component tick and manages AI execution.
+ * Creates and configures the RL component; UEliteRLScheduler steps it (the controller itself does not tick).
  */
 UCLASS()
 class SOULSTRIKE_API AEliteAIController : public AAIController
@@ -24,14 +24,14 @@ protected:
 	virtual void OnUnPossess() override;
 
 public:
-	// We use tick since packaged version does not function properly using timers
-	virtual void Tick(float DeltaTime) override;
+	/** Push values that may change at runtime (decay rate, persistence, debug flag) to the RL component */
+	void SyncRLComponent();
 
 	/** Reference to the RL Component that drives behavior */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI")
 	URLComponent* RLComponent;
 
-	/** How often (in seconds) to run the RL decision loop. 0 = every tick. */
+	/** How often (in seconds) to run the RL decision loop. 0 = every tick. Stepped by UEliteRLScheduler. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Performance")
 	float RLTickInterval;
 
@@ -60,8 +60,4 @@ public:
 	/** How long to hold each action for smoother movement */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Movement", meta = (ClampMin = "0.0"))
 	float ActionPersistenceDuration;
-
-private:
-	/** Time accumulator for RL tick */
-	float RLTickAccumulator;
 };
@@ -0,0 +1,43 @@
+#include "EliteArchetypeComponent.h"
+#include "GameFramework/Pawn.h"
+
+UEliteArchetypeComponent::UEliteArchetypeComponent()
+{
+	PrimaryComponentTick.bCanEverTick = false;
+
+	EliteType = EEliteType::Archer;
+	RoleFlags = 0;
+}
+
+UEliteArchetypeComponent* UEliteArchetypeComponent::FindOrCreate(APawn* Pawn)
+{
+	if (!Pawn)
+		return nullptr;
+
+	if (UEliteArchetypeComponent* Existing = Pawn->FindComponentByClass<UEliteArchetypeComponent>())
+		return Existing;
+
+	UEliteArchetypeRegistry* Registry = UEliteArchetypeRegistry::Get(Pawn->GetWorld());
+	if (!Registry)
+		return nullptr;
+
+	UEliteArchetypeComponent* Component = NewObject<UEliteArchetypeComponent>(Pawn, TEXT("EliteArchetype"));
+	Component->Archetype = Registry->FindArchetype(Pawn->GetClass());
+	Component->EliteType = Component->Archetype.EliteType;
+	Component->RoleFlags = Component->Archetype.RoleFlags;
+	Component->RegisterComponent();
+
+	return Component;
+}
+
+const FEliteArchetype* UEliteArchetypeComponent::FindArchetype(const AActor* Actor)
+{
+	const UEliteArchetypeComponent* Component = Actor ? Actor->FindComponentByClass<UEliteArchetypeComponent>() : nullptr;
+	return Component ? &Component->Archetype : nullptr;
+}
+
+bool UEliteArchetypeComponent::HasRole(const AActor* Actor, EEliteRoleFlags Role)
+{
+	const FEliteArchetype* Found = FindArchetype(Actor);
+	return Found && Found->HasRole(Role);
+}
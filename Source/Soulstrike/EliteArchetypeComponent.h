@@ -0,0 +1,43 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "EliteArchetypeRegistry.h"
+#include "EliteArchetypeComponent.generated.h"
+
+/**
+ * Caches the resolved elite archetype on the pawn, so type and role checks never
+ * have to look at class or actor names again.
+ */
+UCLASS(ClassGroup = (Custom))
+class SOULSTRIKE_API UEliteArchetypeComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UEliteArchetypeComponent();
+
+	/** Resolve the pawn's archetype through the registry and cache it on the pawn (once) */
+	static UEliteArchetypeComponent* FindOrCreate(APawn* Pawn);
+
+	/** Cached archetype of an actor, or null if it is not an elite */
+	static const FEliteArchetype* FindArchetype(const AActor* Actor);
+
+	/** Check a role flag of an actor (false for non-elites) */
+	static bool HasRole(const AActor* Actor, EEliteRoleFlags Role);
+
+	const FEliteArchetype& GetArchetype() const { return Archetype; }
+
+	/** Resolved elite type (for inspection in the editor) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Archetype")
+	EEliteType EliteType;
+
+	/** Resolved role flags (for inspection in the editor) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Archetype", meta = (Bitmask, BitmaskEnum = "EEliteRoleFlags"))
+	int32 RoleFlags;
+
+private:
+	/** Copied from the registry at spawn - editing the registry may reallocate its archetype array */
+	UPROPERTY(Transient)
+	FEliteArchetype Archetype;
+};
@@ -0,0 +1,149 @@
+#include "EliteArchetypeRegistry.h"
+#include "SoulstrikeLog.h"
+#include "QLearningBrain.h"
+#include "RLComponent.h"
+#include "EliteRewards.h"
+#include "ArcherRLComponent.h"
+#include "AssassinRLComponent.h"
+#include "GiantRLComponent.h"
+#include "HealerRLComponent.h"
+#include "PaladinRLComponent.h"
+#include "EliteArcher.h"
+#include "EliteAssassin.h"
+#include "EliteGiant.h"
+#include "EliteHealer.h"
+#include "ElitePaladin.h"
+
+UEliteArchetypeRegistry* UEliteArchetypeRegistry::Instance = nullptr;
+
+static const TCHAR* RegistryAssetPath = TEXT("/Game/Enemy/DA_EliteArchetypes.DA_EliteArchetypes");
+
+FEliteStats FEliteArchetypeStats::ToEliteStats() const
+{
+	FEliteStats Stats;
+	Stats.AttackDamage = AttackDamage;
+	Stats.MaxAttackRange = MaxAttackRange;
+	Stats.AttackWindupDuration = AttackWindupDuration;
+	Stats.AttackCooldown = AttackCooldown;
+	Stats.MovementSpeed = MovementSpeed;
+	Stats.HealAmount = HealAmount;
+	return Stats;
+}
+
+UEliteArchetypeRegistry* UEliteArchetypeRegistry::Get(UWorld* World)
+{
+	if (!Instance && World)
+	{
+		Instance = LoadObject<UEliteArchetypeRegistry>(nullptr, RegistryAssetPath, nullptr, LOAD_NoWarn | LOAD_Quiet);
+		if (Instance)
+		{
+			UE_LOG(LogSoulstrikeAI, Log, TEXT("EliteArchetypeRegistry: Loaded %d archetypes from %s"), Instance->Archetypes.Num(), RegistryAssetPath);
+		}
+		else
+		{
+			Instance = NewObject<UEliteArchetypeRegistry>();
+			Instance->PopulateDefaults();
+			UE_LOG(LogSoulstrikeAI, Log, TEXT("EliteArchetypeRegistry: No registry asset found, using %d built-in archetypes"), Instance->Archetypes.Num());
+		}
+
+		Instance->AddToRoot(); // Prevent garbage collection
+		Instance->BuildClassIndex();
+		Instance->CompileRewardPrograms();
+	}
+	return Instance;
+}
+
+const FEliteArchetype& UEliteArchetypeRegistry::FindArchetype(const UClass* PawnClass) const
+{
+	if (!PawnClass)
+		return FallbackArchetype;
+
+	if (const int32* Cached = ClassIndex.Find(FObjectKey(PawnClass)))
+	{
+		return Archetypes.IsValidIndex(*Cached) ? Archetypes[*Cached] : FallbackArchetype;
+	}
+
+	// First query for this class - walk up to the closest registered (or resolved) ancestor and memoize
+	int32 Index = INDEX_NONE;
+	for (const UClass* Class = PawnClass->GetSuperClass(); Class; Class = Class->GetSuperClass())
+	{
+		if (const int32* Resolved = ClassIndex.Find(FObjectKey(Class)))
+		{
+			Index = *Resolved;
+			break;
+		}
+	}
+	ClassIndex.Add(FObjectKey(PawnClass), Index);
+
+	return Archetypes.IsValidIndex(Index) ? Archetypes[Index] : FallbackArchetype;
+}
+
+void UEliteArchetypeRegistry::BuildClassIndex()
+{
+	ClassIndex.Reset();
+
+	for (int32 i = 0; i < Archetypes.Num(); ++i)
+	{
+		if (UClass* PawnClass = Archetypes[i].PawnClass.LoadSynchronous())
+		{
+			ClassIndex.Add(FObjectKey(PawnClass), i);
+		}
+		else
+		{
+			UE_LOG(LogSoulstrikeAI, Warning, TEXT("EliteArchetypeRegistry: Failed to load pawn class %s"), *Archetypes[i].PawnClass.ToString());
+		}
+	}
+}
+
+void UEliteArchetypeRegistry::CompileRewardPrograms()
+{
+	auto CompileArchetype = [](FEliteArchetype& Archetype)
+	{
+		TSharedRef<FEliteRewardProgram> Program = MakeShared<FEliteRewardProgram>();
+		Program->Compile(Archetype.RewardTerms);
+		Archetype.RewardProgram = Program;
+	};
+
+	for (FEliteArchetype& Archetype : Archetypes)
+	{
+		CompileArchetype(Archetype);
+	}
+	CompileArchetype(FallbackArchetype);
+}
+
+void UEliteArchetypeRegistry::PopulateDefaults()
+{
+	auto AddArchetype = [this](const TCHAR* BlueprintName, EEliteType Type, TSubclassOf<URLComponent> RLComponentClass,
+		TSubclassOf<AEliteEnemy> BehaviorClass, EEliteRoleFlags Roles)
+	{
+		FEliteArchetype& Archetype = Archetypes.AddDefaulted_GetRef();
+		Archetype.PawnClass = TSoftClassPtr<APawn>(FSoftObjectPath(
+			FString::Printf(TEXT("/Game/ThirdPersonBP/Blueprints/EliteAI/%s.%s_C"), BlueprintName, BlueprintName)));
+		Archetype.EliteType = Type;
+		Archetype.RLComponentClass = RLComponentClass;
+		Archetype.BehaviorClass = BehaviorClass;
+		Archetype.RoleFlags = (int32)Roles;
+		Archetype.RewardTerms = EliteRewards::MakeDefaultTerms(Type);
+	};
+
+	AddArchetype(TEXT("BP_EliteArcher"), EEliteType::Archer, UArcherRLComponent::StaticClass(), AEliteArcher::StaticClass(), EEliteRoleFlags::ProtectedAlly);
+	AddArchetype(TEXT("BP_EliteAssassin"), EEliteType::Assassin, UAssassinRLComponent::StaticClass(), AEliteAssassin::StaticClass(), EEliteRoleFlags::None);
+	AddArchetype(TEXT("BP_EliteGiant"), EEliteType::Giant, UGiantRLComponent::StaticClass(), AEliteGiant::StaticClass(), EEliteRoleFlags::Protector);
+	AddArchetype(TEXT("BP_EliteHealer"), EEliteType::Healer, UHealerRLComponent::StaticClass(), AEliteHealer::StaticClass(), EEliteRoleFlags::ProtectedAlly | EEliteRoleFlags::Healer);
+	AddArchetype(TEXT("BP_ElitePaladin"), EEliteType::Paladin, UPaladinRLComponent::StaticClass(), AElitePaladin::StaticClass(), EEliteRoleFlags::Protector);
+
+	// Unknown elites behave like the base component (same as before archetypes existed)
+	FallbackArchetype.EliteType = EEliteType::Archer;
+	FallbackArchetype.RLComponentClass = URLComponent::StaticClass();
+	FallbackArchetype.BehaviorClass = AEliteEnemy::StaticClass();
+}
+
+#if WITH_EDITOR
+void UEliteArchetypeRegistry::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	BuildClassIndex();
+	CompileRewardPrograms();
+}
+#endif
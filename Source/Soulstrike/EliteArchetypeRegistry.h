@@ -0,0 +1,174 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "UObject/ObjectKey.h"
+#include "WeightManager.h"
+#include "EliteRewardProgram.h"
+#include "EliteArchetypeRegistry.generated.h"
+
+class AEliteEnemy;
+class URLComponent;
+struct FEliteStats;
+
+/**
+ * Role flags other elites react to (e.g. Giant and Paladin protect ProtectedAlly roles)
+ */
+UENUM(BlueprintType, meta = (Bitflags, UseEnumValuesAsMaskValuesInEditor = "true"))
+enum class EEliteRoleFlags : uint8
+{
+	None = 0 UMETA(Hidden),
+	ProtectedAlly = 1 << 0 UMETA(DisplayName = "Protected Ally"),
+	Protector = 1 << 1 UMETA(DisplayName = "Protector"),
+	Healer = 1 << 2 UMETA(DisplayName = "Healer")
+};
+ENUM_CLASS_FLAGS(EEliteRoleFlags);
+
+/**
+ * RL hyperparameters for an archetype.
+ * Only applied when bOverrideControllerTuning is set, otherwise the AI controller's values are used.
+ */
+USTRUCT(BlueprintType)
+struct FEliteBrainConfig
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Brain")
+	bool bOverrideControllerTuning = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Brain", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "bOverrideControllerTuning"))
+	float LearningRate = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Brain", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "bOverrideControllerTuning"))
+	float DiscountFactor = 0.95f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Brain", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "bOverrideControllerTuning"))
+	float ExplorationRate = 0.2f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Brain", meta = (ClampMin = "0.0", EditCondition = "bOverrideControllerTuning"))
+	float ExplorationDecayRate = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Brain", meta = (ClampMin = "0.0", EditCondition = "bOverrideControllerTuning"))
+	float ActionPersistenceDuration = 0.3f;
+};
+
+/**
+ * Fallback stats for an archetype, used when the pawn Blueprint does not define the property
+ */
+USTRUCT(BlueprintType)
+struct FEliteArchetypeStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+	float AttackDamage = 10.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+	float MaxAttackRange = 500.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+	float AttackWindupDuration = 0.3f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+	float AttackCooldown = 0.5f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+	float MovementSpeed = 400.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Stats")
+	float HealAmount = 50.0f;
+
+	FEliteStats ToEliteStats() const;
+};
+
+/**
+ * Everything the AI needs to know about one kind of elite pawn
+ */
+USTRUCT(BlueprintType)
+struct FEliteArchetype
+{
+	GENERATED_BODY()
+
+	/** Pawn class this archetype applies to (Blueprint subclasses resolve to it as well) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype")
+	TSoftClassPtr<APawn> PawnClass;
+
+	/** Elite type used for weight persistence */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype")
+	EEliteType EliteType = EEliteType::Archer;
+
+	/** RL component created by the AI controller on possession */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype")
+	TSubclassOf<URLComponent> RLComponentClass;
+
+	/** C++ behavior class whose CDO drives attack logic */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype")
+	TSubclassOf<AEliteEnemy> BehaviorClass;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype")
+	FEliteBrainConfig Brain;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype")
+	FEliteArchetypeStats DefaultStats;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetype", meta = (Bitmask, BitmaskEnum = "EEliteRoleFlags"))
+	int32 RoleFlags = 0;
+
+	/** Reward terms summed every learning step. Empty = the elite type's built-in reward function. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward", meta = (TitleProperty = "Name"))
+	TArray<FEliteRewardTerm> RewardTerms;
+
+	/**
+	 * RewardTerms compiled by the registry on load and on edit. Every edit compiles a new program,
+	 * so elites spawned before it keep evaluating (and batching on) the one they were spawned with.
+	 */
+	TSharedPtr<const FEliteRewardProgram> RewardProgram;
+
+	bool HasRole(EEliteRoleFlags Role) const { return (RoleFlags & (int32)Role) != 0; }
+};
+
+/**
+ * Elite Archetype Registry - data asset mapping elite pawn classes to their archetype.
+ * Loaded from /Game/Enemy/DA_EliteArchetypes; when that asset does not exist the built-in
+ * defaults for the five BP_Elite* pawns are used.
+ */
+UCLASS(BlueprintType)
+class SOULSTRIKE_API UEliteArchetypeRegistry : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the singleton registry (loaded on first use) */
+	static UEliteArchetypeRegistry* Get(UWorld* World);
+
+	/** Archetype for a pawn class, or the fallback archetype when it is not registered */
+	const FEliteArchetype& FindArchetype(const UClass* PawnClass) const;
+
+	/** Registered archetypes */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetypes")
+	TArray<FEliteArchetype> Archetypes;
+
+	/** Used for elite pawns that match no archetype */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Archetypes")
+	FEliteArchetype FallbackArchetype;
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	/** Fill in the archetypes of the stock BP_Elite* pawns */
+	void PopulateDefaults();
+
+	/** Load the registered pawn classes and index them */
+	void BuildClassIndex();
+
+	/** Compile every archetype's reward terms */
+	void CompileRewardPrograms();
+
+	/** Pawn class -> archetype index (INDEX_NONE for the fallback), memoized per queried class */
+	mutable TMap<FObjectKey, int32> ClassIndex;
+
+	/** Singleton instance */
+	static UEliteArchetypeRegistry* Instance;
+};
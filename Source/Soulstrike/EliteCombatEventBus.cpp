@@ -0,0 +1,123 @@
+#include "EliteCombatEventBus.h"
+#include "EnemyLogicManager.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "HAL/IConsoleManager.h"
+
+static FAutoConsoleCommandWithWorld GEliteCombatEventsCommand(
+	TEXT("Soulstrike.AI.CombatEvents"),
+	TEXT("Print how many combat events were queued and how many aggregated reports they became."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&UEliteCombatEventBus::DumpStats));
+
+UEliteCombatEventBus* UEliteCombatEventBus::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UEliteCombatEventBus>() : nullptr;
+}
+
+void UEliteCombatEventBus::Deinitialize()
+{
+	Events.Empty();
+	Totals.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEliteCombatEventBus::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEliteCombatEventBus, STATGROUP_Tickables);
+}
+
+void UEliteCombatEventBus::PushDamage(ACharacter* Target, float Damage, AActor* Source)
+{
+	Push(Target, Damage, Source, EEventType::Damage);
+}
+
+void UEliteCombatEventBus::PushHeal(ACharacter* Target, float HealAmount, AActor* Source)
+{
+	Push(Target, HealAmount, Source, EEventType::Heal);
+}
+
+void UEliteCombatEventBus::Push(ACharacter* Target, float Amount, AActor* Source, EEventType Type)
+{
+	if (!Target)
+		return;
+
+	FCombatEvent Event;
+	Event.Target = Target;
+	Event.Source = Source;
+	Event.Amount = Amount;
+	Event.Type = Type;
+	Events.Enqueue(Event);
+}
+
+void UEliteCombatEventBus::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_CombatEvents);
+	SOULSTRIKE_AI_STAGE(CombatEvents);
+
+	// Sum the frame's events per target (a handful of targets, so a linear search is fine)
+	Totals.Reset();
+	int32 NumEvents = 0;
+
+	FCombatEvent Event;
+	while (Events.Dequeue(Event))
+	{
+		++NumEvents;
+
+		FTargetTotal* Total = Totals.FindByPredicate([&Event](const FTargetTotal& Entry)
+		{
+			return Entry.Target == Event.Target && Entry.Type == Event.Type;
+		});
+		if (!Total)
+		{
+			Total = &Totals.AddDefaulted_GetRef();
+			Total->Target = Event.Target;
+			Total->Type = Event.Type;
+		}
+
+		Total->Amount += Event.Amount;
+		if (Event.Amount > Total->LargestAmount || !Total->Source.IsValid())
+		{
+			Total->LargestAmount = Event.Amount;
+			Total->Source = Event.Source;
+		}
+	}
+
+	TotalEvents += NumEvents;
+	SET_DWORD_STAT(STAT_SoulstrikeAI_CombatEventsQueued, NumEvents);
+
+	AEnemyLogicManager* Manager = LogicManager.Get();
+	if (!Manager)
+		return;
+
+	for (const FTargetTotal& Total : Totals)
+	{
+		ACharacter* Target = Total.Target.Get();
+		if (!Target)
+			continue;
+
+		if (Total.Type == EEventType::Damage)
+		{
+			Manager->ReportDamageToPlayer(Target, Total.Amount, Total.Source.Get());
+		}
+		else
+		{
+			Manager->ReportHealToAlly(Target, Total.Amount, Total.Source.Get());
+		}
+		++TotalDeliveries;
+	}
+}
+
+void UEliteCombatEventBus::DumpStats(UWorld* World)
+{
+	UEliteCombatEventBus* Bus = Get(World);
+	if (!Bus)
+		return;
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteCombatEventBus: %lld events delivered as %lld reports (logic manager %s)"),
+		Bus->TotalEvents, Bus->TotalDeliveries, Bus->LogicManager.IsValid() ? TEXT("bound") : TEXT("missing"));
+}
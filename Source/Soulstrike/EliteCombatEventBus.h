@@ -0,0 +1,81 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "SoulstrikeTickableWorldSubsystem.h"
+#include "EliteCombatEventBus.generated.h"
+
+class ACharacter;
+class AEnemyLogicManager;
+
+/**
+ * Elite Combat Event Bus - collects damage and heal events from any thread and delivers them
+ * once per frame. Pushing is a lock-free enqueue (multi-producer, single-consumer queue);
+ * the frame's events are summed per target and handed to AEnemyLogicManager as one report per
+ * target, so a burst of melee hits costs one log line and one Blueprint broadcast.
+ */
+UCLASS()
+class SOULSTRIKE_API UEliteCombatEventBus : public USoulstrikeTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the bus for a world (null for non-game worlds) */
+	static UEliteCombatEventBus* Get(const UWorld* World);
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Queue damage dealt to the player (any thread) */
+	void PushDamage(ACharacter* Target, float Damage, AActor* Source);
+
+	/** Queue healing done to an ally (any thread) */
+	void PushHeal(ACharacter* Target, float HealAmount, AActor* Source);
+
+	/** Logic manager the aggregated events are delivered to (set by the manager on BeginPlay) */
+	void SetLogicManager(AEnemyLogicManager* InLogicManager) { LogicManager = InLogicManager; }
+
+	/** Print delivery counters to the log (Soulstrike.AI.CombatEvents) */
+	static void DumpStats(UWorld* World);
+
+private:
+	enum class EEventType : uint8
+	{
+		Damage,
+		Heal
+	};
+
+	struct FCombatEvent
+	{
+		TWeakObjectPtr<ACharacter> Target;
+		TWeakObjectPtr<AActor> Source;
+		float Amount = 0.0f;
+		EEventType Type = EEventType::Damage;
+	};
+
+	/** A frame's events against one target */
+	struct FTargetTotal
+	{
+		TWeakObjectPtr<ACharacter> Target;
+		EEventType Type = EEventType::Damage;
+		float Amount = 0.0f;
+
+		/** Source of the largest single event, reported as the instigator */
+		TWeakObjectPtr<AActor> Source;
+		float LargestAmount = 0.0f;
+	};
+
+	void Push(ACharacter* Target, float Amount, AActor* Source, EEventType Type);
+
+	TQueue<FCombatEvent, EQueueMode::Mpsc> Events;
+
+	/** Reused every frame */
+	TArray<FTargetTotal> Totals;
+
+	TWeakObjectPtr<AEnemyLogicManager> LogicManager;
+
+	int64 TotalEvents = 0;
+	int64 TotalDeliveries = 0;
+};
@@ -0,0 +1,122 @@
+#include "EliteCombatTimeline.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+
+static FAutoConsoleCommandWithWorld GEliteCombatTimelineCommand(
+	TEXT("Soulstrike.AI.CombatTimeline"),
+	TEXT("Print pending and resolved attack windups."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&UEliteCombatTimeline::DumpStats));
+
+UEliteCombatTimeline* UEliteCombatTimeline::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UEliteCombatTimeline>() : nullptr;
+}
+
+void UEliteCombatTimeline::Deinitialize()
+{
+	Pending.Empty();
+	Due.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEliteCombatTimeline::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEliteCombatTimeline, STATGROUP_Tickables);
+}
+
+void UEliteCombatTimeline::ScheduleWindup(AActor* Attacker, float WindupDuration, float MaxRange, FOnAttackWindupResolved OnResolved)
+{
+	if (!Attacker)
+		return;
+
+	FPendingWindup Windup;
+	Windup.DueTime = GetWorld()->GetTimeSeconds() + FMath::Max(0.0f, WindupDuration);
+	Windup.Sequence = NextSequence++;
+	Windup.Attacker = Attacker;
+	Windup.MaxRange = MaxRange;
+	Windup.OnResolved = MoveTemp(OnResolved);
+
+	Pending.HeapPush(MoveTemp(Windup), FDueFirst());
+}
+
+void UEliteCombatTimeline::GetAttackersDueWithin(float Seconds, TArray<AActor*>& OutAttackers) const
+{
+	OutAttackers.Reset();
+
+	// The heap is only partially ordered - a full scan is fine for a handful of windups
+	const double Horizon = GetWorld()->GetTimeSeconds() + Seconds;
+	for (const FPendingWindup& Windup : Pending)
+	{
+		AActor* Attacker = Windup.Attacker.Get();
+		if (Attacker && Windup.DueTime <= Horizon)
+		{
+			OutAttackers.Add(Attacker);
+		}
+	}
+}
+
+void UEliteCombatTimeline::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_CombatTimeline);
+	SOULSTRIKE_AI_STAGE(CombatTimeline);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	Due.Reset();
+	while (Pending.Num() > 0 && Pending.HeapTop().DueTime <= Now)
+	{
+		FPendingWindup& Windup = Due.AddDefaulted_GetRef();
+		Pending.HeapPop(Windup, FDueFirst(), false);
+	}
+
+	SET_DWORD_STAT(STAT_SoulstrikeAI_PendingWindups, Pending.Num());
+
+	if (Due.Num() == 0)
+		return;
+
+	// One range check pass for everything that came due
+	ACharacter* Player = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
+	const FVector PlayerLocation = Player ? Player->GetActorLocation() : FVector::ZeroVector;
+
+	Results.Reset();
+	Results.AddDefaulted(Due.Num());
+	for (int32 i = 0; i < Due.Num(); ++i)
+	{
+		const AActor* Attacker = Due[i].Attacker.Get();
+		if (!Attacker || !Player)
+			continue;
+
+		FAttackWindupResult& Result = Results[i];
+		Result.Player = Player;
+		Result.DistanceToPlayer = FVector::Dist(Attacker->GetActorLocation(), PlayerLocation);
+		Result.bInRange = Result.DistanceToPlayer <= Due[i].MaxRange;
+	}
+
+	// Deliver in due order (owners may schedule new windups from their handlers)
+	for (int32 i = 0; i < Due.Num(); ++i)
+	{
+		if (!Due[i].Attacker.IsValid())
+			continue;
+
+		++TotalResolved;
+		TotalHits += Results[i].bInRange ? 1 : 0;
+		Due[i].OnResolved.ExecuteIfBound(Results[i]);
+	}
+}
+
+void UEliteCombatTimeline::DumpStats(UWorld* World)
+{
+	UEliteCombatTimeline* Timeline = Get(World);
+	if (!Timeline)
+		return;
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteCombatTimeline: %d windups pending, %lld resolved (%lld in range)"),
+		Timeline->Pending.Num(), Timeline->TotalResolved, Timeline->TotalHits);
+}
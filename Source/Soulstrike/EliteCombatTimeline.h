@@ -0,0 +1,92 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SoulstrikeTickableWorldSubsystem.h"
+#include "EliteCombatTimeline.generated.h"
+
+class ACharacter;
+
+/**
+ * Outcome of an attack windup, checked against the player when the windup ends
+ */
+struct FAttackWindupResult
+{
+	/** Player the range check was made against (null when there is none) */
+	ACharacter* Player = nullptr;
+
+	/** Attacker to player distance when the windup ended */
+	float DistanceToPlayer = 0.0f;
+
+	/** Player still within the attack's range */
+	bool bInRange = false;
+};
+
+DECLARE_DELEGATE_OneParam(FOnAttackWindupResolved, const FAttackWindupResult&);
+
+/**
+ * Elite Combat Timeline - one queue of pending attack windups for elites and swarm enemies.
+ * Windups wait in a min-heap keyed by game time; each frame every windup that has come due is
+ * range checked against the player in one pass, then the results are handed to their owners.
+ */
+UCLASS()
+class SOULSTRIKE_API UEliteCombatTimeline : public USoulstrikeTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the timeline for a world (null for non-game worlds) */
+	static UEliteCombatTimeline* Get(const UWorld* World);
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Resolve an attack WindupDuration seconds from now. The result is delivered through OnResolved
+	 * (bind it to a UObject so it is dropped if the owner is gone). Dropped if the attacker is gone.
+	 */
+	void ScheduleWindup(AActor* Attacker, float WindupDuration, float MaxRange, FOnAttackWindupResolved OnResolved);
+
+	/** Attackers whose windup resolves within the next Seconds (what a player sees telegraphed) */
+	void GetAttackersDueWithin(float Seconds, TArray<AActor*>& OutAttackers) const;
+
+	/** Number of windups waiting */
+	int32 GetNumPending() const { return Pending.Num(); }
+
+	/** Print timeline counters to the log (Soulstrike.AI.CombatTimeline) */
+	static void DumpStats(UWorld* World);
+
+private:
+	struct FPendingWindup
+	{
+		double DueTime = 0.0;
+
+		/** Keeps windups due at the same time in scheduling order */
+		uint64 Sequence = 0;
+
+		TWeakObjectPtr<AActor> Attacker;
+		float MaxRange = 0.0f;
+		FOnAttackWindupResolved OnResolved;
+	};
+
+	/** Heap order: earliest due first */
+	struct FDueFirst
+	{
+		bool operator()(const FPendingWindup& A, const FPendingWindup& B) const
+		{
+			return A.DueTime < B.DueTime || (A.DueTime == B.DueTime && A.Sequence < B.Sequence);
+		}
+	};
+
+	TArray<FPendingWindup> Pending;
+
+	/** Reused every frame */
+	TArray<FPendingWindup> Due;
+	TArray<FAttackWindupResult> Results;
+
+	uint64 NextSequence = 0;
+
+	int64 TotalResolved = 0;
+	int64 TotalHits = 0;
+};
@@ -0,0 +1,228 @@
+#include "EliteDebugOverlay.h"
+#include "SoulstrikeLog.h"
+#include "RLTypes.h"
+#include "WeightManager.h"
+#include "EliteSignificanceManager.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "DrawDebugHelpers.h"
+#include "HAL/IConsoleManager.h"
+
+static float GEliteDebugOverlayCrosshairDegrees = 12.0f;
+static FAutoConsoleVariableRef CVarEliteDebugOverlayCrosshairDegrees(
+	TEXT("Soulstrike.AI.DebugOverlay.CrosshairDegrees"),
+	GEliteDebugOverlayCrosshairDegrees,
+	TEXT("Half-angle around the crosshair an elite must be within to be drawn (when no filter is set)."));
+
+static float GEliteDebugOverlayMaxDistance = 5000.0f;
+static FAutoConsoleVariableRef CVarEliteDebugOverlayMaxDistance(
+	TEXT("Soulstrike.AI.DebugOverlay.MaxDistance"),
+	GEliteDebugOverlayMaxDistance,
+	TEXT("Elites further than this from the camera are never drawn."));
+
+static int32 GEliteDebugOverlayMaxElites = 4;
+static FAutoConsoleVariableRef CVarEliteDebugOverlayMaxElites(
+	TEXT("Soulstrike.AI.DebugOverlay.MaxElites"),
+	GEliteDebugOverlayMaxElites,
+	TEXT("Most elites drawn per frame (closest to the crosshair first)."));
+
+static float GEliteDebugOverlayStaleSeconds = 1.5f;
+static FAutoConsoleVariableRef CVarEliteDebugOverlayStaleSeconds(
+	TEXT("Soulstrike.AI.DebugOverlay.StaleSeconds"),
+	GEliteDebugOverlayStaleSeconds,
+	TEXT("A record older than this is dropped (the elite stopped stepping or left debug mode)."));
+
+static FString GEliteDebugOverlayFilter;
+static FAutoConsoleVariableRef CVarEliteDebugOverlayFilter(
+	TEXT("Soulstrike.AI.DebugOverlay.Filter"),
+	GEliteDebugOverlayFilter,
+	TEXT("Comma separated elite types to draw regardless of the crosshair (e.g. \"Archer,Healer\" or \"All\"). Empty = crosshair only."));
+
+static FAutoConsoleCommandWithWorld GEliteDebugOverlayCommand(
+	TEXT("Soulstrike.AI.DebugOverlay.Stats"),
+	TEXT("Print how many debug records were written and drawn."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&UEliteDebugOverlay::DumpStats));
+
+UEliteDebugOverlay* UEliteDebugOverlay::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UEliteDebugOverlay>() : nullptr;
+}
+
+void UEliteDebugOverlay::Deinitialize()
+{
+	Ring.Empty();
+	Latest.Empty();
+	Candidates.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEliteDebugOverlay::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEliteDebugOverlay, STATGROUP_Tickables);
+}
+
+void UEliteDebugOverlay::Write(const FEliteDebugRecord& Record)
+{
+#if ENABLE_DRAW_DEBUG
+	if (Ring.Num() == 0)
+	{
+		Ring.SetNumUninitialized(RingCapacity);
+	}
+
+	Ring[WriteCount % RingCapacity] = Record;
+	++WriteCount;
+	++TotalWritten;
+#endif
+}
+
+void UEliteDebugOverlay::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+#if ENABLE_DRAW_DEBUG
+	if (WriteCount == ReadCount && Latest.Num() == 0)
+		return;
+
+	ConsumeRing();
+
+	// Forget elites that stopped writing
+	const float Now = GetWorld()->GetTimeSeconds();
+	for (auto It = Latest.CreateIterator(); It; ++It)
+	{
+		if (Now - It.Value().Time > GEliteDebugOverlayStaleSeconds)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (!PlayerController || Latest.Num() == 0)
+		return;
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+	const FVector ViewDirection = ViewRotation.Vector();
+
+	const float MinCrosshairCos = FMath::Cos(FMath::DegreesToRadians(GEliteDebugOverlayCrosshairDegrees));
+	const float MaxDistanceSquared = FMath::Square(GEliteDebugOverlayMaxDistance);
+	const uint32 FilterMask = GetFilterMask();
+
+	// Rank by how close to the crosshair each elite is (higher cosine first)
+	Candidates.Reset();
+	for (const TPair<uint32, FEliteDebugRecord>& Entry : Latest)
+	{
+		const FEliteDebugRecord& Record = Entry.Value;
+		const FVector ToElite = Record.Location - ViewLocation;
+		const float DistanceSquared = ToElite.SizeSquared();
+		if (DistanceSquared > MaxDistanceSquared)
+			continue;
+
+		const float CrosshairCos = DistanceSquared > KINDA_SMALL_NUMBER ? FVector::DotProduct(ToElite, ViewDirection) * FMath::InvSqrt(DistanceSquared) : 1.0f;
+		const bool bMatchesFilter = (FilterMask & (1u << Record.EliteType)) != 0;
+		if (!bMatchesFilter && CrosshairCos < MinCrosshairCos)
+			continue;
+
+		Candidates.Emplace(CrosshairCos, &Record);
+	}
+
+	Candidates.Sort([](const TPair<float, const FEliteDebugRecord*>& A, const TPair<float, const FEliteDebugRecord*>& B)
+	{
+		return A.Key > B.Key;
+	});
+
+	const int32 NumToDraw = FMath::Min(Candidates.Num(), FMath::Max(0, GEliteDebugOverlayMaxElites));
+	for (int32 i = 0; i < NumToDraw; ++i)
+	{
+		DrawRecord(*Candidates[i].Value);
+	}
+	TotalDrawn += NumToDraw;
+#endif
+}
+
+void UEliteDebugOverlay::ConsumeRing()
+{
+	// Writers lapped us: everything older than one ring is gone
+	if (WriteCount - ReadCount > RingCapacity)
+	{
+		TotalOverwritten += WriteCount - ReadCount - RingCapacity;
+		ReadCount = WriteCount - RingCapacity;
+	}
+
+	for (; ReadCount != WriteCount; ++ReadCount)
+	{
+		const FEliteDebugRecord& Record = Ring[ReadCount % RingCapacity];
+		Latest.Add(Record.EliteId, Record);
+	}
+}
+
+uint32 UEliteDebugOverlay::GetFilterMask()
+{
+	if (GEliteDebugOverlayFilter == CachedFilter)
+		return CachedFilterMask;
+
+	CachedFilter = GEliteDebugOverlayFilter;
+	CachedFilterMask = 0;
+
+	TArray<FString> Tokens;
+	CachedFilter.ParseIntoArray(Tokens, TEXT(","));
+
+	const UEnum* TypeEnum = StaticEnum<EEliteType>();
+	for (FString& Token : Tokens)
+	{
+		Token.TrimStartAndEndInline();
+		if (Token.Equals(TEXT("All"), ESearchCase::IgnoreCase))
+		{
+			CachedFilterMask = MAX_uint32;
+			break;
+		}
+
+		for (int32 i = 0; i < TypeEnum->NumEnums() - 1; ++i)
+		{
+			if (TypeEnum->GetNameStringByIndex(i).Equals(Token, ESearchCase::IgnoreCase))
+			{
+				CachedFilterMask |= 1u << TypeEnum->GetValueByIndex(i);
+			}
+		}
+	}
+
+	return CachedFilterMask;
+}
+
+void UEliteDebugOverlay::DrawRecord(const FEliteDebugRecord& Record) const
+{
+#if ENABLE_DRAW_DEBUG
+	static const UEnum* TypeEnum = StaticEnum<EEliteType>();
+	static const UEnum* ActionEnum = StaticEnum<EEliteAction>();
+	static const UEnum* AttackStateEnum = StaticEnum<EAttackState>();
+	static const UEnum* SignificanceEnum = StaticEnum<EEliteSignificance>();
+
+	const FString DebugText = FString::Printf(
+		TEXT("%s (%s)\nState: %s\nAction: %s\nR: %.2f\nDist: %.2f (%.0f/%.0f)\nHP: %.2f\nDPS: %.1f\nEps: %.2f"),
+		*TypeEnum->GetNameStringByValue(Record.EliteType),
+		*SignificanceEnum->GetNameStringByValue(Record.Significance),
+		*AttackStateEnum->GetNameStringByValue(Record.AttackState),
+		*ActionEnum->GetNameStringByValue(Record.Action),
+		Record.Reward,
+		Record.NormalizedDistance,
+		Record.DistanceToPlayer,
+		Record.MaxAttackRange,
+		Record.HealthPercentage,
+		Record.DPS,
+		Record.Epsilon);
+
+	// Single frame: the overlay redraws every frame from the newest record
+	DrawDebugString(GetWorld(), Record.Location + FVector(0, 0, 150), DebugText, nullptr, FColor::Yellow, 0.0f, true);
+#endif
+}
+
+void UEliteDebugOverlay::DumpStats(UWorld* World)
+{
+	UEliteDebugOverlay* Overlay = Get(World);
+	if (!Overlay)
+		return;
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteDebugOverlay: %lld records written (%lld overwritten before drawing), %d elites tracked, %lld labels drawn"),
+		Overlay->TotalWritten, Overlay->TotalOverwritten, Overlay->Latest.Num(), Overlay->TotalDrawn);
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SoulstrikeTickableWorldSubsystem.h"
+#include "EliteDebugOverlay.generated.h"
+
+/**
+ * One elite's debug readout for an RL step. Plain data: writing one is a copy into the ring,
+ * all formatting happens in the overlay and only for the elites it draws.
+ */
+struct FEliteDebugRecord
+{
+	/** Elite's world position when the record was written */
+	FVector Location = FVector::ZeroVector;
+
+	/** Owner's UObject unique id (identifies the elite across records) */
+	uint32 EliteId = 0;
+
+	/** Game time the record was written */
+	float Time = 0.0f;
+
+	float Reward = 0.0f;
+	float NormalizedDistance = 0.0f;
+	float DistanceToPlayer = 0.0f;
+	float MaxAttackRange = 0.0f;
+	float HealthPercentage = 0.0f;
+	float DPS = 0.0f;
+	float Epsilon = 0.0f;
+
+	/** EEliteType, EEliteAction, EAttackState, EEliteSignificance */
+	uint8 EliteType = 0;
+	uint8 Action = 0;
+	uint8 AttackState = 0;
+	uint8 Significance = 0;
+};
+
+static_assert(std::is_trivially_copyable<FEliteDebugRecord>::value, "FEliteDebugRecord must stay plain data");
+
+/**
+ * Elite Debug Overlay - single renderer for elite RL debug text.
+ * High-significance elites in debug mode write an FEliteDebugRecord per step into a fixed-size ring; once per frame
+ * the overlay keeps the newest record per elite and draws only the elites near the crosshair, or
+ * the ones matching Soulstrike.AI.DebugOverlay.Filter. Elites not in debug mode never touch it,
+ * and everything compiles out with ENABLE_DRAW_DEBUG.
+ */
+UCLASS()
+class SOULSTRIKE_API UEliteDebugOverlay : public USoulstrikeTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the overlay for a world (null for non-game worlds) */
+	static UEliteDebugOverlay* Get(const UWorld* World);
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Queue a record for drawing (game thread). Overwrites the oldest record when the ring is full */
+	void Write(const FEliteDebugRecord& Record);
+
+	/** Print overlay counters to the log (Soulstrike.AI.DebugOverlay.Stats) */
+	static void DumpStats(UWorld* World);
+
+private:
+	static constexpr uint32 RingCapacity = 1024;
+
+	/** Move the records written since the last frame into Latest */
+	void ConsumeRing();
+
+	/** Elite type mask for the current filter string (0 = no filter, crosshair selection) */
+	uint32 GetFilterMask();
+
+	void DrawRecord(const FEliteDebugRecord& Record) const;
+
+	/** Ring storage (allocated on the first write) */
+	TArray<FEliteDebugRecord> Ring;
+
+	/** Records ever written / consumed; the ring index is the count modulo capacity */
+	uint32 WriteCount = 0;
+	uint32 ReadCount = 0;
+
+	/** Newest record per elite, dropped once stale */
+	TMap<uint32, FEliteDebugRecord> Latest;
+
+	/** Reused every frame */
+	TArray<TPair<float, const FEliteDebugRecord*>> Candidates;
+
+	/** Filter string the mask was built from */
+	FString CachedFilter;
+	uint32 CachedFilterMask = 0;
+
+	int64 TotalWritten = 0;
+	int64 TotalOverwritten = 0;
+	int64 TotalDrawn = 0;
+};
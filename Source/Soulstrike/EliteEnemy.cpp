@@ -1,4 +1,5 @@
 #include "EliteEnemy.h"
+#include "SoulstrikeLog.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
@@ -82,7 +83,7 @@ bool AEliteEnemy::IsAlive() const
 void AEliteEnemy::Die()
 {
 	// Log death
-	UE_LOG(LogTemp, Warning, TEXT("Elite %s has died."), *GetName());
+	UE_LOG(LogSoulstrikeAI, Log, TEXT("Elite %s has died."), *GetName());
 
 	// Disable collision and movement
 	GetCapsuleComponent()->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -96,14 +97,14 @@ void AEliteEnemy::PerformPrimaryAttack()
 {
 	// Base implementation: log attack
 	// Subclasses will override to implement specific attacks
-	UE_LOG(LogTemp, Log, TEXT("%s: Performing primary attack (base)"), *GetName());
+	UE_LOG(LogSoulstrikeAI, Log, TEXT("%s: Performing primary attack (base)"), *GetName());
 }
 
 void AEliteEnemy::PerformSecondaryAttack()
 {
 	// Base implementation: do nothing
 	// Subclasses will override for special abilities
-	UE_LOG(LogTemp, Log, TEXT("%s: Performing secondary attack (base)"), *GetName());
+	UE_LOG(LogSoulstrikeAI, Log, TEXT("%s: Performing secondary attack (base)"), *GetName());
 }
 
 void AEliteEnemy::OnAttackComplete()
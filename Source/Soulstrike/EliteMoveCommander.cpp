@@ -0,0 +1,218 @@
+#include "EliteMoveCommander.h"
+#include "SoulstrikeStats.h"
+#include "AIController.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "NavFilters/NavigationQueryFilter.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static float GEliteMoveRepathDistance = 150.0f;
+static FAutoConsoleVariableRef CVarEliteMoveRepathDistance(
+	TEXT("Soulstrike.AI.Movement.RepathDistance"),
+	GEliteMoveRepathDistance,
+	TEXT("A location move is re-requested once the wanted goal is this far from the goal being followed."));
+
+static float GEliteMoveMinRepathInterval = 0.2f;
+static FAutoConsoleVariableRef CVarEliteMoveMinRepathInterval(
+	TEXT("Soulstrike.AI.Movement.MinRepathInterval"),
+	GEliteMoveMinRepathInterval,
+	TEXT("Seconds before the same movement action is re-requested after its path completed or failed."));
+
+static float GEliteMoveGoalCacheSeconds = 3.0f;
+static FAutoConsoleVariableRef CVarEliteMoveGoalCacheSeconds(
+	TEXT("Soulstrike.AI.Movement.GoalCacheSeconds"),
+	GEliteMoveGoalCacheSeconds,
+	TEXT("How long a retreat/strafe goal that produced a path is reused."));
+
+static float GEliteMoveGoalCacheTolerance = 250.0f;
+static FAutoConsoleVariableRef CVarEliteMoveGoalCacheTolerance(
+	TEXT("Soulstrike.AI.Movement.GoalCacheTolerance"),
+	GEliteMoveGoalCacheTolerance,
+	TEXT("A cached goal is reused while it is within this distance of the point the action wants."));
+
+namespace EliteMoveCandidates
+{
+	/** Candidates closer than this to the elite are not worth a path */
+	const float MinMoveDistance = 150.0f;
+
+	/** Search box for projecting a candidate onto the navmesh */
+	const FVector ProjectionExtent(150.0f, 150.0f, 300.0f);
+
+	/** Fallbacks after the wanted point: shorter, then turned either way */
+	const float DistanceScales[] = { 1.0f, 0.6f, 1.0f, 1.0f };
+	const float YawOffsets[] = { 0.0f, 0.0f, 35.0f, -35.0f };
+}
+
+void FEliteMoveCommander::MoveToActor(AAIController* Controller, EEliteAction Action, AActor* Goal, float AcceptanceRadius)
+{
+	WantedAction = Action;
+
+	if (IsFollowing(Controller, Action) || !CanRetry(Controller, Action))
+	{
+		INC_DWORD_STAT(STAT_SoulstrikeAI_MovesCoalesced);
+		return;
+	}
+
+	Controller->MoveToActor(Goal, AcceptanceRadius);
+	INC_DWORD_STAT(STAT_SoulstrikeAI_PathRequests);
+	OnIssued(Controller, Action, Goal->GetActorLocation(), Controller->GetCurrentMoveRequestID());
+}
+
+void FEliteMoveCommander::MoveToLocation(AAIController* Controller, EEliteAction Action, const FVector& PlayerLocation, const FVector& Location, float AcceptanceRadius)
+{
+	WantedAction = Action;
+
+	// Keep following while the query for this action runs
+	const bool bQueryPending = PendingQueryID != INVALID_NAVQUERYID && PendingAction == Action;
+	const bool bGoalDrifted = FVector::DistSquared(Location, ActiveWantedLocation) > FMath::Square(GEliteMoveRepathDistance);
+	if (bQueryPending || (IsFollowing(Controller, Action) && !bGoalDrifted) || !CanRetry(Controller, Action))
+	{
+		INC_DWORD_STAT(STAT_SoulstrikeAI_MovesCoalesced);
+		return;
+	}
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(Controller->GetWorld());
+	const APawn* Pawn = Controller->GetPawn();
+	const ANavigationData* NavData = NavSys && Pawn ? NavSys->GetNavDataForProps(Pawn->GetNavAgentPropertiesRef(), Pawn->GetNavAgentLocation()) : nullptr;
+	if (!NavData)
+	{
+		// No navmesh to query asynchronously - plain move
+		Controller->MoveToLocation(Location, AcceptanceRadius);
+		INC_DWORD_STAT(STAT_SoulstrikeAI_PathRequests);
+		OnIssued(Controller, Action, Location, Controller->GetCurrentMoveRequestID());
+		return;
+	}
+
+	FVector Goal;
+	if (!FindGoal(Controller, Action, PlayerLocation, Location, Goal))
+	{
+		// Nothing navigable that way - wait out the retry interval instead of failing every step
+		INC_DWORD_STAT(STAT_SoulstrikeAI_MovePathsFailed);
+		OnIssued(Controller, Action, Location, FAIRequestID::InvalidRequest);
+		return;
+	}
+
+	// A query for an action we moved away from is no longer wanted
+	if (PendingQueryID != INVALID_NAVQUERYID)
+	{
+		NavSys->AbortAsyncFindPathRequest(PendingQueryID);
+	}
+
+	FPathFindingQuery Query(Controller, *NavData, Pawn->GetNavAgentLocation(), Goal,
+		UNavigationQueryFilter::GetQueryFilter(*NavData, Controller, Controller->GetDefaultNavigationFilterClass()));
+	Query.SetAllowPartialPaths(true);
+
+	const TWeakObjectPtr<AAIController> WeakController(Controller);
+	const FNavPathQueryDelegate Delegate = FNavPathQueryDelegate::CreateWeakLambda(Owner.Get(),
+		[this, WeakController, Action, PlayerLocation, Location, Goal, AcceptanceRadius](uint32 QueryID, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+		{
+			OnPathFound(QueryID, Result, Path, WeakController, Action, PlayerLocation, Location, Goal, AcceptanceRadius);
+		});
+
+	PendingQueryID = NavSys->FindPathAsync(Pawn->GetNavAgentPropertiesRef(), Query, Delegate);
+	PendingAction = Action;
+	INC_DWORD_STAT(STAT_SoulstrikeAI_PathRequests);
+}
+
+bool FEliteMoveCommander::IsFollowing(const AAIController* Controller, EEliteAction Action) const
+{
+	// Completed, failed and aborted paths all leave path following idle; anyone else's move replaces our request id
+	return bHasMove
+		&& ActiveAction == Action
+		&& ActiveRequestID.IsValid()
+		&& Controller->GetMoveStatus() != EPathFollowingStatus::Idle
+		&& Controller->GetCurrentMoveRequestID() == ActiveRequestID;
+}
+
+bool FEliteMoveCommander::CanRetry(const AAIController* Controller, EEliteAction Action) const
+{
+	// Standing at the goal reports idle every step - don't hammer the same request
+	return !bHasMove
+		|| ActiveAction != Action
+		|| Controller->GetWorld()->GetTimeSeconds() - IssueTime >= GEliteMoveMinRepathInterval;
+}
+
+bool FEliteMoveCommander::FindGoal(const AAIController* Controller, EEliteAction Action, const FVector& PlayerLocation, const FVector& Location, FVector& OutGoal)
+{
+	// Reuse a goal that already produced a path while it still serves the action
+	const FCachedGoal& Cached = CachedGoals[static_cast<int32>(Action)];
+	if (Cached.bValid && Controller->GetWorld()->GetTimeSeconds() - Cached.Time <= GEliteMoveGoalCacheSeconds)
+	{
+		const FVector CachedGoal = PlayerLocation + Cached.PlayerOffset;
+		if (FVector::DistSquared(CachedGoal, Location) <= FMath::Square(GEliteMoveGoalCacheTolerance))
+		{
+			INC_DWORD_STAT(STAT_SoulstrikeAI_MoveGoalCacheHits);
+			OutGoal = CachedGoal;
+			return true;
+		}
+	}
+
+	const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(Controller->GetWorld());
+	const FVector Origin = Controller->GetPawn()->GetNavAgentLocation();
+	const FVector Offset = Location - Origin;
+
+	// Projection is a local navmesh lookup, not a path search
+	for (int32 i = 0; i < UE_ARRAY_COUNT(EliteMoveCandidates::DistanceScales); ++i)
+	{
+		const FVector Candidate = Origin + Offset.RotateAngleAxis(EliteMoveCandidates::YawOffsets[i], FVector::UpVector) * EliteMoveCandidates::DistanceScales[i];
+
+		FNavLocation Projected;
+		if (NavSys->ProjectPointToNavigation(Candidate, Projected, EliteMoveCandidates::ProjectionExtent)
+			&& FVector::DistSquared2D(Projected.Location, Origin) >= FMath::Square(EliteMoveCandidates::MinMoveDistance))
+		{
+			OutGoal = Projected.Location;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FEliteMoveCommander::OnPathFound(uint32 QueryID, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path, TWeakObjectPtr<AAIController> WeakController,
+	EEliteAction Action, FVector PlayerLocation, FVector WantedLocation, FVector Goal, float AcceptanceRadius)
+{
+	// Superseded by a newer query
+	if (QueryID != PendingQueryID)
+		return;
+
+	PendingQueryID = INVALID_NAVQUERYID;
+
+	AAIController* Controller = WeakController.Get();
+	if (!Controller || !Controller->GetPawn())
+		return;
+
+	FCachedGoal& Cached = CachedGoals[static_cast<int32>(Action)];
+	if (Result != ENavigationQueryResult::Success || !Path.IsValid())
+	{
+		Cached.bValid = false;
+		INC_DWORD_STAT(STAT_SoulstrikeAI_MovePathsFailed);
+		OnIssued(Controller, Action, WantedLocation, FAIRequestID::InvalidRequest);
+		return;
+	}
+
+	Cached.PlayerOffset = Goal - PlayerLocation;
+	Cached.Time = Controller->GetWorld()->GetTimeSeconds();
+	Cached.bValid = true;
+
+	// The decision moved on while the query ran; the goal stays cached for next time
+	if (WantedAction != Action)
+		return;
+
+	FAIMoveRequest MoveRequest(Goal);
+	MoveRequest.SetAcceptanceRadius(AcceptanceRadius);
+	MoveRequest.SetAllowPartialPath(true);
+
+	Path->EnableRecalculationOnInvalidation(true);
+	OnIssued(Controller, Action, WantedLocation, Controller->RequestMove(MoveRequest, Path));
+}
+
+void FEliteMoveCommander::OnIssued(const AAIController* Controller, EEliteAction Action, const FVector& WantedLocation, FAIRequestID RequestID)
+{
+	bHasMove = true;
+	ActiveAction = Action;
+	ActiveWantedLocation = WantedLocation;
+	ActiveRequestID = RequestID;
+	IssueTime = Controller->GetWorld()->GetTimeSeconds();
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AITypes.h"
+#include "AI/Navigation/NavigationTypes.h"
+#include "RLTypes.h"
+
+class AAIController;
+class AActor;
+
+/**
+ * Movement command layer between an elite's RL actions and its AI controller.
+ * Every step asks for a move, but a new path request only goes out when the movement action
+ * changes, the wanted goal drifted past Soulstrike.AI.Movement.RepathDistance from the one being
+ * followed, or the controller's path completed, failed or was replaced. Otherwise the current path
+ * keeps being followed. Actor goals are tracked by path following itself, so they only repath on
+ * action changes and finished paths.
+ *
+ * Location moves (retreat, strafe) never path synchronously: the wanted point, or the nearest
+ * candidate around it that projects onto the navmesh, is sent as an async path query and the elite
+ * keeps its current path until the result arrives. Goals that produced a path are cached per
+ * action relative to the player and reused while they still match what the action wants.
+ */
+class SOULSTRIKE_API FEliteMoveCommander
+{
+public:
+	/** Object whose lifetime bounds async query callbacks (the owning RL component) */
+	void SetOwner(UObject* InOwner) { Owner = InOwner; }
+
+	/** Follow Goal for a movement action */
+	void MoveToActor(AAIController* Controller, EEliteAction Action, AActor* Goal, float AcceptanceRadius);
+
+	/** Head for Location (or the closest navigable point around it) for a movement action */
+	void MoveToLocation(AAIController* Controller, EEliteAction Action, const FVector& PlayerLocation, const FVector& Location, float AcceptanceRadius);
+
+private:
+	/** A goal that produced a path, stored relative to the player */
+	struct FCachedGoal
+	{
+		FVector PlayerOffset = FVector::ZeroVector;
+		float Time = -BIG_NUMBER;
+		bool bValid = false;
+	};
+
+	static constexpr int32 NumActions = 6;
+
+	/** Whether the controller is still following the move we issued for Action */
+	bool IsFollowing(const AAIController* Controller, EEliteAction Action) const;
+
+	/** A path that just ended is not retried sooner than the minimum repath interval */
+	bool CanRetry(const AAIController* Controller, EEliteAction Action) const;
+
+	/** Cached goal still close to Location, else the first navmesh-projected candidate around it */
+	bool FindGoal(const AAIController* Controller, EEliteAction Action, const FVector& PlayerLocation, const FVector& Location, FVector& OutGoal);
+
+	void OnPathFound(uint32 QueryID, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path, TWeakObjectPtr<AAIController> WeakController,
+		EEliteAction Action, FVector PlayerLocation, FVector WantedLocation, FVector Goal, float AcceptanceRadius);
+
+	/** Remember a move (or a failed attempt, with an invalid request id) for Action */
+	void OnIssued(const AAIController* Controller, EEliteAction Action, const FVector& WantedLocation, FAIRequestID RequestID);
+
+	TWeakObjectPtr<UObject> Owner;
+
+	bool bHasMove = false;
+	EEliteAction ActiveAction = EEliteAction::Move_Towards_Player;
+	FVector ActiveWantedLocation = FVector::ZeroVector;
+	FAIRequestID ActiveRequestID;
+	float IssueTime = -BIG_NUMBER;
+
+	/** Most recently requested movement action (a path for anything else arrived too late) */
+	EEliteAction WantedAction = EEliteAction::Move_Towards_Player;
+
+	uint32 PendingQueryID = INVALID_NAVQUERYID;
+	EEliteAction PendingAction = EEliteAction::Move_Towards_Player;
+
+	FCachedGoal CachedGoals[NumActions];
+};
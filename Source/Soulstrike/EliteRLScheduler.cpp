@@ -0,0 +1,346 @@
+#include "EliteRLScheduler.h"
+#include "EliteAIController.h"
+#include "EliteAIClock.h"
+#include "EliteSignificanceManager.h"
+#include "RLComponent.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeStats.h"
+#include "SoulstrikeTrace.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "Async/ParallelFor.h"
+
+static int32 GEliteStepBudgetMicroseconds = 2000;
+static FAutoConsoleVariableRef CVarEliteStepBudgetMicroseconds(
+	TEXT("Soulstrike.AI.StepBudgetMicroseconds"),
+	GEliteStepBudgetMicroseconds,
+	TEXT("Time budget per frame for elite RL steps. At least one due elite always steps per frame."));
+
+static int32 GEliteParallelStep = 1;
+static FAutoConsoleVariableRef CVarEliteParallelStep(
+	TEXT("Soulstrike.AI.ParallelStep"),
+	GEliteParallelStep,
+	TEXT("Build elite states and run inference on worker threads (0 = game thread only)."));
+
+static int32 GEliteParallelMinBatch = 4;
+static FAutoConsoleVariableRef CVarEliteParallelMinBatch(
+	TEXT("Soulstrike.AI.ParallelMinBatch"),
+	GEliteParallelMinBatch,
+	TEXT("Smallest batch of deciding elites worth spreading over worker threads."));
+
+static FAutoConsoleCommandWithWorld GEliteStepStatsCommand(
+	TEXT("Soulstrike.AI.StepStats"),
+	TEXT("Print elite RL step scheduling counters (steps vs. deferred to a later frame)."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&UEliteRLScheduler::DumpStats));
+
+UEliteRLScheduler* UEliteRLScheduler::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UEliteRLScheduler>() : nullptr;
+}
+
+void UEliteRLScheduler::Deinitialize()
+{
+	Elites.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEliteRLScheduler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEliteRLScheduler, STATGROUP_Tickables);
+}
+
+void UEliteRLScheduler::Register(AEliteAIController* Controller, URLComponent* Component)
+{
+	if (!Controller || !Component)
+		return;
+
+	for (FScheduledElite& Elite : Elites)
+	{
+		if (Elite.Controller.Get() == Controller)
+		{
+			Elite.Component = Component;
+			Elite.AccumulatedTime = 0.0f;
+			return;
+		}
+	}
+
+	FScheduledElite& Elite = Elites.AddDefaulted_GetRef();
+	Elite.Controller = Controller;
+	Elite.Component = Component;
+}
+
+void UEliteRLScheduler::Unregister(AEliteAIController* Controller)
+{
+	// Only cleared here - the entry is removed at the start of the next walk
+	for (FScheduledElite& Elite : Elites)
+	{
+		if (Elite.Controller.Get() == Controller)
+		{
+			Elite.Controller = nullptr;
+			Elite.Component = nullptr;
+		}
+	}
+}
+
+void UEliteRLScheduler::RemoveInvalidEntries()
+{
+	for (int32 i = Elites.Num() - 1; i >= 0; --i)
+	{
+		if (!Elites[i].Controller.IsValid() || !Elites[i].Component.IsValid())
+		{
+			Elites.RemoveAt(i, 1, false);
+			if (i < Cursor)
+			{
+				--Cursor;
+			}
+		}
+	}
+
+	if (Cursor >= Elites.Num())
+	{
+		Cursor = 0;
+	}
+}
+
+void UEliteRLScheduler::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_RLScheduler);
+	SOULSTRIKE_AI_STAGE(RLScheduler);
+
+	RemoveInvalidEntries();
+
+	// Controllers do not tick, so their per-frame work happens here
+	for (FScheduledElite& Elite : Elites)
+	{
+		AEliteAIController* Controller = Elite.Controller.Get();
+		Controller->SyncRLComponent();
+		Controller->UpdateControlRotation(DeltaTime);
+	}
+
+	// A fixed-rate clock runs zero or more AI steps this frame; otherwise the frame is one step
+	const UEliteAIClock* Clock = UEliteAIClock::Get(GetWorld());
+	const int32 NumClockSteps = Clock ? Clock->GetStepsThisFrame() : 1;
+	const float StepDeltaTime = Clock ? Clock->GetStepDeltaTime(DeltaTime) : DeltaTime;
+
+	// Size this frame's batches from the measured cost of a step
+	const double Budget = FMath::Max(0, GEliteStepBudgetMicroseconds) / 1000000.0;
+	int32 BudgetSteps = FMath::Max(1, FMath::FloorToInt(Budget / FMath::Max(AverageStepCost, 0.000001)));
+
+	int32 Steps = 0;
+	int32 Deferred = 0;
+	for (int32 ClockStep = 0; ClockStep < NumClockSteps; ++ClockStep)
+	{
+		StepElites(StepDeltaTime, BudgetSteps, Steps, Deferred);
+	}
+
+	if (Deferred > 0)
+	{
+		++FramesOverBudget;
+	}
+
+	LastFrameSteps = Steps;
+	LastFrameDeferred = Deferred;
+	TotalSteps += Steps;
+	TotalDeferred += Deferred;
+	++NumFrames;
+
+	SET_DWORD_STAT(STAT_SoulstrikeAI_LiveElites, Elites.Num());
+	CSV_CUSTOM_STAT(SoulstrikeAI, LiveElites, Elites.Num(), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SoulstrikeAI, RLSteps, Steps, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SoulstrikeAI, RLStepsDeferred, Deferred, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SoulstrikeAI, AIClockSteps, NumClockSteps, ECsvCustomStatOp::Set);
+	SET_DWORD_STAT(STAT_SoulstrikeAI_RLSteps, Steps);
+	SET_DWORD_STAT(STAT_SoulstrikeAI_RLStepsDeferred, Deferred);
+}
+
+void UEliteRLScheduler::StepElites(float StepDeltaTime, int32& BudgetSteps, int32& OutSteps, int32& OutDeferred)
+{
+	// Everyone ages, stepped or not - a deferred elite gets the full elapsed time when it runs
+	for (FScheduledElite& Elite : Elites)
+	{
+		Elite.AccumulatedTime += StepDeltaTime;
+	}
+
+	UEliteSignificanceManager* SignificanceManager = UEliteSignificanceManager::Get(GetWorld());
+
+	Batch.Reset();
+	int32 NextCursor = INDEX_NONE;
+
+	const int32 Num = Elites.Num();
+	for (int32 Offset = 0; Offset < Num; ++Offset)
+	{
+		const int32 Index = (Cursor + Offset) % Num;
+		FScheduledElite& Elite = Elites[Index];
+		AEliteAIController* Controller = Elite.Controller.Get();
+
+		// Less significant elites step less often (never more often than the controller's RLTickInterval)
+		const EEliteSignificance Significance = SignificanceManager
+			? SignificanceManager->GetSignificance(Controller->GetPawn())
+			: EEliteSignificance::High;
+		const float StepInterval = FMath::Max(Controller->RLTickInterval, UEliteSignificanceManager::GetStepInterval(Significance));
+
+		if (Elite.AccumulatedTime < StepInterval)
+			continue;
+
+		// Out of budget - the first elite we could not serve starts the next walk
+		// (the first walk of a frame always serves at least one elite)
+		if (Batch.Num() >= BudgetSteps && (Batch.Num() > 0 || OutSteps > 0))
+		{
+			if (NextCursor == INDEX_NONE)
+			{
+				NextCursor = Index;
+			}
+			++OutDeferred;
+			continue;
+		}
+
+		Batch.Add({ Elite.Component.Get(), Significance, Elite.AccumulatedTime });
+		Elite.AccumulatedTime = 0.0f;
+	}
+
+	if (NextCursor != INDEX_NONE)
+	{
+		Cursor = NextCursor;
+	}
+
+	if (Batch.Num() > 0)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		StepBatch();
+		const double StepCost = (FPlatformTime::Seconds() - StartTime) / Batch.Num();
+		AverageStepCost = FMath::Lerp(AverageStepCost, StepCost, 0.1);
+	}
+
+	BudgetSteps = FMath::Max(0, BudgetSteps - Batch.Num());
+	OutSteps += Batch.Num();
+}
+
+void UEliteRLScheduler::StepBatch()
+{
+	SOULSTRIKE_TRACE_SCOPE(SoulstrikeAI_StepBatch);
+
+	// === PHASE 1: BEGIN STEPS (game thread) ===
+	Deciding.Reset();
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_PhaseBegin);
+		CSV_SCOPED_TIMING_STAT(SoulstrikeAI, PhaseBegin);
+		for (const FBatchedStep& Step : Batch)
+		{
+			FScopeCycleCounter StepCycleCounter(UEliteSignificanceManager::GetStepStatId(Step.Significance));
+			Step.Component->SetSignificance(Step.Significance);
+			if (Step.Component->BeginRLStep(Step.DeltaTime))
+			{
+				Deciding.Add(Step.Component);
+			}
+		}
+	}
+
+	if (Deciding.Num() == 0)
+		return;
+
+	const bool bSingleThread = !GEliteParallelStep || Deciding.Num() < GEliteParallelMinBatch;
+
+	// === PHASE 2: BUILD STATES (parallel, read-only snapshot) ===
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_PhaseBuildStates);
+		CSV_SCOPED_TIMING_STAT(SoulstrikeAI, PhaseBuildStates);
+		Snapshot.Capture(GetWorld());
+
+		ParallelFor(Deciding.Num(), [this](int32 Index)
+		{
+			Deciding[Index]->BuildStateFromSnapshot(Snapshot);
+		}, bSingleThread);
+	}
+
+	// === PHASE 3: REWARDS (batched per reward program) ===
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_PhaseRewards);
+		CSV_SCOPED_TIMING_STAT(SoulstrikeAI, PhaseRewards);
+		EvaluateRewards(bSingleThread);
+	}
+
+	// === PHASE 4: INFERENCE (parallel) ===
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_PhaseInference);
+		CSV_SCOPED_TIMING_STAT(SoulstrikeAI, PhaseInference);
+		ParallelFor(Deciding.Num(), [this](int32 Index)
+		{
+			Deciding[Index]->RunInference();
+		}, bSingleThread);
+	}
+
+	// === PHASE 5: APPLY ACTIONS (game thread) ===
+	{
+		SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_PhaseApply);
+		CSV_SCOPED_TIMING_STAT(SoulstrikeAI, PhaseApply);
+		for (URLComponent* Component : Deciding)
+		{
+			Component->ApplyRLStep();
+		}
+	}
+}
+
+void UEliteRLScheduler::EvaluateRewards(bool bSingleThread)
+{
+	for (FRewardBatch& RewardBatch : RewardBatches)
+	{
+		RewardBatch.Components.Reset();
+		RewardBatch.Contexts.Reset();
+	}
+
+	// Elites without a program (or debugging) evaluate their own reward during inference
+	int32 NumBatches = 0;
+	for (URLComponent* Component : Deciding)
+	{
+		const FEliteRewardProgram* Program = Component->GetBatchedRewardProgram();
+		if (!Program)
+			continue;
+
+		int32 BatchIndex = 0;
+		while (BatchIndex < NumBatches && RewardBatches[BatchIndex].Program != Program)
+		{
+			++BatchIndex;
+		}
+		if (BatchIndex == NumBatches)
+		{
+			if (NumBatches == RewardBatches.Num())
+			{
+				RewardBatches.AddDefaulted();
+			}
+			RewardBatches[NumBatches++].Program = Program;
+		}
+
+		RewardBatches[BatchIndex].Components.Add(Component);
+		RewardBatches[BatchIndex].Contexts.Add(&Component->GetRewardContext());
+	}
+
+	ParallelFor(NumBatches, [this](int32 Index)
+	{
+		FRewardBatch& RewardBatch = RewardBatches[Index];
+		RewardBatch.Rewards.SetNumUninitialized(RewardBatch.Components.Num(), false);
+		RewardBatch.Program->Evaluate(RewardBatch.Contexts, RewardBatch.Rewards);
+
+		for (int32 i = 0; i < RewardBatch.Components.Num(); ++i)
+		{
+			RewardBatch.Components[i]->SetStepReward(RewardBatch.Rewards[i]);
+		}
+	}, bSingleThread);
+}
+
+void UEliteRLScheduler::DumpStats(UWorld* World)
+{
+	UEliteRLScheduler* Scheduler = Get(World);
+	if (!Scheduler)
+		return;
+
+	const float Frames = FMath::Max(1, Scheduler->NumFrames);
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteRLScheduler: last frame - %d steps, %d deferred"),
+		Scheduler->LastFrameSteps, Scheduler->LastFrameDeferred);
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteRLScheduler: %d frames - %.2f steps/frame, %.2f deferred/frame, %d frames over budget (%d us), %d elites"),
+		Scheduler->NumFrames, Scheduler->TotalSteps / Frames, Scheduler->TotalDeferred / Frames,
+		Scheduler->FramesOverBudget, GEliteStepBudgetMicroseconds, Scheduler->Elites.Num());
+}
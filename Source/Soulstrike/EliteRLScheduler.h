@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SoulstrikeTickableWorldSubsystem.h"
+#include "EliteWorldSnapshot.h"
+#include "EliteRLScheduler.generated.h"
+
+class AEliteAIController;
+class URLComponent;
+class FEliteRewardProgram;
+struct FEliteRewardContext;
+enum class EEliteSignificance : uint8;
+
+/**
+ * Elite RL Scheduler - owns every elite's RL component and steps them from one place under a
+ * per-frame time budget (Soulstrike.AI.StepBudgetMicroseconds). Elites are walked round-robin;
+ * each one that is due gets its true accumulated DeltaTime. When the budget runs out, the walk
+ * resumes from the first unserved elite next frame, so frame cost stays bounded however many
+ * elites are alive and newly possessed elites do not all step in the same frame.
+ *
+ * The elites picked for a frame are stepped as a batch, in phases:
+ *   1. begin steps (game thread) - timers, attack state machine, own-actor reads, LOS query
+ *   2. build all states and reward contexts in parallel from one read-only world snapshot
+ *   3. rewards - elites sharing a compiled reward program are evaluated together, column by column
+ *   4. inference in parallel - weight updates and action selection
+ *   5. apply actions (game thread)
+ * Elite controllers do not tick; the scheduler also does their per-frame work.
+ *
+ * With a fixed-rate AI clock (UEliteAIClock) the walk runs once per clock step with the fixed step
+ * DeltaTime - possibly zero or several times a frame - and the budget covers all of a frame's walks.
+ */
+UCLASS()
+class SOULSTRIKE_API UEliteRLScheduler : public USoulstrikeTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the scheduler for a world (null for non-game worlds) */
+	static UEliteRLScheduler* Get(const UWorld* World);
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Start stepping a controller's RL component */
+	void Register(AEliteAIController* Controller, URLComponent* Component);
+
+	/** Stop stepping a controller's RL component */
+	void Unregister(AEliteAIController* Controller);
+
+	/** Print scheduling counters to the log (Soulstrike.AI.StepStats) */
+	static void DumpStats(UWorld* World);
+
+private:
+	struct FScheduledElite
+	{
+		TWeakObjectPtr<AEliteAIController> Controller;
+		TWeakObjectPtr<URLComponent> Component;
+
+		/** Time since this elite last stepped */
+		float AccumulatedTime = 0.0f;
+	};
+
+	/** An elite picked to step this frame */
+	struct FBatchedStep
+	{
+		URLComponent* Component;
+		EEliteSignificance Significance;
+		float DeltaTime;
+	};
+
+	/** Drop entries whose controller or component is gone, keeping the cursor on the same elite */
+	void RemoveInvalidEntries();
+
+	/** Age every elite by one AI step and step the due ones that fit in the remaining BudgetSteps */
+	void StepElites(float StepDeltaTime, int32& BudgetSteps, int32& OutSteps, int32& OutDeferred);
+
+	/** Run the phases over the picked elites */
+	void StepBatch();
+
+	/** Elites of this frame's batch that share a reward program */
+	struct FRewardBatch
+	{
+		const FEliteRewardProgram* Program = nullptr;
+		TArray<URLComponent*> Components;
+		TArray<const FEliteRewardContext*> Contexts;
+		TArray<float> Rewards;
+	};
+
+	/** Group the deciding elites by reward program and evaluate each group in one pass */
+	void EvaluateRewards(bool bSingleThread);
+
+	TArray<FScheduledElite> Elites;
+
+	/** Reused every frame */
+	TArray<FBatchedStep> Batch;
+	TArray<URLComponent*> Deciding;
+	TArray<FRewardBatch> RewardBatches;
+	FEliteWorldSnapshot Snapshot;
+
+	/** Smoothed cost of one elite step in seconds, used to size the batch to the budget */
+	double AverageStepCost = 0.00005;
+
+	/** Index of the elite the next walk starts from */
+	int32 Cursor = 0;
+
+	int32 LastFrameSteps = 0;
+	int32 LastFrameDeferred = 0;
+	int64 TotalSteps = 0;
+	int64 TotalDeferred = 0;
+	int32 FramesOverBudget = 0;
+	int32 NumFrames = 0;
+};
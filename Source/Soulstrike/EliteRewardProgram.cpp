@@ -0,0 +1,272 @@
+#include "EliteRewardProgram.h"
+#include "EliteArchetypeRegistry.h"
+#include "Misc/MemStack.h"
+
+static bool IsProtectedRewardAlly(const FEliteRewardAlly& Ally)
+{
+	return (Ally.RoleFlags & (int32)EEliteRoleFlags::ProtectedAlly) != 0;
+}
+
+float FEliteRewardProgram::ReadInput(const FEliteRewardContext& Context, EEliteRewardInput Input)
+{
+	const FRLState& State = Context.CurrentState;
+
+	switch (Input)
+	{
+	case EEliteRewardInput::DistanceToPlayer:
+		return State.DistanceToPlayer;
+	case EEliteRewardInput::DeltaDistance:
+		return Context.GetDeltaDistance();
+	case EEliteRewardInput::DeltaDistanceNormalized:
+		return Context.GetDeltaDistance() / Context.MaxAttackRange;
+	case EEliteRewardInput::BeyondMaxRange:
+		return State.bIsBeyondMaxRange ? 1.0f : 0.0f;
+	case EEliteRewardInput::LineOfSight:
+		return State.bHasLineOfSightToPlayer ? 1.0f : 0.0f;
+	case EEliteRewardInput::TookDamageRecently:
+		return State.bTookDamageRecently ? 1.0f : 0.0f;
+	case EEliteRewardInput::DeltaHealth:
+		return State.SelfHealthPercentage - Context.PreviousState.SelfHealthPercentage;
+	case EEliteRewardInput::NumNearbyAllies:
+		return State.NumNearbyAllies;
+	case EEliteRewardInput::DistanceToClosestAlly:
+		return State.DistanceToClosestAlly;
+	case EEliteRewardInput::AllyCover:
+		return State.DistanceToPlayer - State.DistanceToClosestAlly;
+	case EEliteRewardInput::AverageAllyHealth:
+		return (State.HealthOfClosestAlly + State.HealthOfSecondClosestAlly + State.HealthOfThirdClosestAlly) / 3.0f;
+	case EEliteRewardInput::DPS:
+		return Context.CurrentDPS;
+	case EEliteRewardInput::DeltaDPS:
+		return Context.CurrentDPS - Context.PreviousDPS;
+	case EEliteRewardInput::HPS:
+		return Context.CurrentHPS;
+	case EEliteRewardInput::DeltaHPS:
+		return Context.CurrentHPS - Context.PreviousHPS;
+	case EEliteRewardInput::ActivePoisons:
+		return (float)Context.NumActivePoisons;
+	case EEliteRewardInput::AttackReady:
+		return Context.AttackState == EAttackState::Normal ? 1.0f : 0.0f;
+	case EEliteRewardInput::LastActionPrimary:
+		return Context.LastAction == EEliteAction::Primary_Attack ? 1.0f : 0.0f;
+	case EEliteRewardInput::LastActionSecondary:
+		return Context.LastAction == EEliteAction::Secondary_Attack ? 1.0f : 0.0f;
+	case EEliteRewardInput::LastActionStrafe:
+		return (Context.LastAction == EEliteAction::Strafe_Left || Context.LastAction == EEliteAction::Strafe_Right) ? 1.0f : 0.0f;
+	case EEliteRewardInput::ProtectedAlliesShielded:
+	{
+		// Standing between the player and the ally
+		int32 Count = 0;
+		for (const FEliteRewardAlly& Ally : Context.ClosestAllies)
+		{
+			if (IsProtectedRewardAlly(Ally) && Ally.DistanceToSelf < Ally.DistanceToPlayer
+				&& State.DistanceToPlayer < Ally.DistanceToPlayer / Context.MaxAttackRange)
+			{
+				++Count;
+			}
+		}
+		return (float)Count;
+	}
+	case EEliteRewardInput::ProtectedAlliesGuarded:
+	{
+		// Close to the ally and closer to the player than it is
+		int32 Count = 0;
+		for (const FEliteRewardAlly& Ally : Context.ClosestAllies)
+		{
+			if (IsProtectedRewardAlly(Ally) && Ally.DistanceToSelf <= 700.0f
+				&& State.DistanceToPlayer * Context.MaxAttackRange < Ally.DistanceToPlayer)
+			{
+				++Count;
+			}
+		}
+		return (float)Count;
+	}
+	default:
+		return 0.0f;
+	}
+}
+
+int32 FEliteRewardProgram::GetOrAddColumn(EEliteRewardInput Input)
+{
+	return Columns.AddUnique(Input);
+}
+
+void FEliteRewardProgram::Compile(const TArray<FEliteRewardTerm>& Terms)
+{
+	Columns.Reset();
+	Conditions.Reset();
+	Ops.Reset();
+
+	auto AddConditions = [this](const TArray<FEliteRewardCondition>& Source, int32& OutFirst, int32& OutNum)
+	{
+		OutFirst = Conditions.Num();
+		OutNum = Source.Num();
+		for (const FEliteRewardCondition& Condition : Source)
+		{
+			Conditions.Add({ GetOrAddColumn(Condition.Input), Condition.Min, Condition.Max });
+		}
+	};
+
+	for (const FEliteRewardTerm& Term : Terms)
+	{
+		// A zero-weight term with no fallback value can never contribute
+		if (Term.Weight == 0.0f && (Term.Tests.Num() == 0 || Term.ElseValue == 0.0f))
+			continue;
+
+		FOp& Op = Ops.AddDefaulted_GetRef();
+		Op.Shape = Term.Shape;
+		Op.Column = Term.Shape == EEliteRewardShape::Constant ? INDEX_NONE : GetOrAddColumn(Term.Input);
+		Op.Threshold = Term.Threshold;
+		Op.Slope = Term.Slope;
+		Op.ClampMin = Term.bClamp ? Term.ClampMin : -MAX_FLT;
+		Op.ClampMax = Term.bClamp ? Term.ClampMax : MAX_FLT;
+		Op.Weight = Term.Weight;
+		Op.ElseValue = Term.ElseValue;
+		Op.Name = Term.Name;
+		AddConditions(Term.Conditions, Op.FirstCondition, Op.NumConditions);
+		AddConditions(Term.Tests, Op.FirstTest, Op.NumTests);
+	}
+}
+
+void FEliteRewardProgram::Evaluate(TArrayView<const FEliteRewardContext* const> Contexts, TArrayView<float> OutRewards) const
+{
+	check(Contexts.Num() == OutRewards.Num());
+
+	const int32 Num = Contexts.Num();
+	if (Num == 0)
+		return;
+
+	// Scratch lives on the calling thread's mem stack
+	FMemMark Mark(FMemStack::Get());
+
+	// Extract every input the program reads, one contiguous column per input
+	TArray<float, TMemStackAllocator<>> Inputs;
+	Inputs.SetNumUninitialized(Columns.Num() * Num);
+	for (int32 Column = 0; Column < Columns.Num(); ++Column)
+	{
+		float* ColumnValues = Inputs.GetData() + Column * Num;
+		for (int32 i = 0; i < Num; ++i)
+		{
+			ColumnValues[i] = ReadInput(*Contexts[i], Columns[Column]);
+		}
+	}
+
+	TArray<float, TMemStackAllocator<>> Gate;
+	TArray<float, TMemStackAllocator<>> Pass;
+	TArray<float, TMemStackAllocator<>> Values;
+	Gate.SetNumUninitialized(Num);
+	Pass.SetNumUninitialized(Num);
+	Values.SetNumUninitialized(Num);
+
+	// Multiply a 0/1 mask by every range test in [First, First + Count)
+	auto ApplyConditions = [&](float* Mask, int32 First, int32 Count)
+	{
+		for (int32 i = 0; i < Num; ++i)
+		{
+			Mask[i] = 1.0f;
+		}
+		for (int32 c = First; c < First + Count; ++c)
+		{
+			const FCondition& Condition = Conditions[c];
+			const float* X = Inputs.GetData() + Condition.Column * Num;
+			for (int32 i = 0; i < Num; ++i)
+			{
+				Mask[i] *= (X[i] >= Condition.Min) & (X[i] <= Condition.Max) ? 1.0f : 0.0f;
+			}
+		}
+	};
+
+	for (int32 i = 0; i < Num; ++i)
+	{
+		OutRewards[i] = 0.0f;
+	}
+
+	for (const FOp& Op : Ops)
+	{
+		ApplyConditions(Gate.GetData(), Op.FirstCondition, Op.NumConditions);
+		ApplyConditions(Pass.GetData(), Op.FirstTest, Op.NumTests);
+
+		// Shape, one loop per shape so the inner loops stay branch-free
+		const float* X = Op.Column != INDEX_NONE ? Inputs.GetData() + Op.Column * Num : nullptr;
+		switch (Op.Shape)
+		{
+		case EEliteRewardShape::Linear:
+			for (int32 i = 0; i < Num; ++i) Values[i] = X[i];
+			break;
+		case EEliteRewardShape::RampBelow:
+			for (int32 i = 0; i < Num; ++i) Values[i] = FMath::Max(0.0f, Op.Threshold - X[i]);
+			break;
+		case EEliteRewardShape::RampAbove:
+			for (int32 i = 0; i < Num; ++i) Values[i] = FMath::Max(0.0f, X[i] - Op.Threshold);
+			break;
+		default:
+			for (int32 i = 0; i < Num; ++i) Values[i] = 1.0f;
+			break;
+		}
+
+		for (int32 i = 0; i < Num; ++i)
+		{
+			const float Value = Op.Weight * FMath::Clamp(Op.Slope * Values[i], Op.ClampMin, Op.ClampMax);
+			OutRewards[i] += Gate[i] * (Pass[i] * Value + (1.0f - Pass[i]) * Op.ElseValue);
+		}
+	}
+}
+
+float FEliteRewardProgram::EvaluateOne(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown) const
+{
+	auto Holds = [this, &Context](int32 First, int32 Count)
+	{
+		for (int32 c = First; c < First + Count; ++c)
+		{
+			const FCondition& Condition = Conditions[c];
+			const float X = ReadInput(Context, Columns[Condition.Column]);
+			if (X < Condition.Min || X > Condition.Max)
+				return false;
+		}
+		return true;
+	};
+
+	float Reward = 0.0f;
+	for (const FOp& Op : Ops)
+	{
+		float Value = 0.0f;
+		if (Holds(Op.FirstCondition, Op.NumConditions))
+		{
+			if (Holds(Op.FirstTest, Op.NumTests))
+			{
+				const float X = Op.Column != INDEX_NONE ? ReadInput(Context, Columns[Op.Column]) : 1.0f;
+				float Shaped = 1.0f;
+				switch (Op.Shape)
+				{
+				case EEliteRewardShape::Linear: Shaped = X; break;
+				case EEliteRewardShape::RampBelow: Shaped = FMath::Max(0.0f, Op.Threshold - X); break;
+				case EEliteRewardShape::RampAbove: Shaped = FMath::Max(0.0f, X - Op.Threshold); break;
+				default: break;
+				}
+				Value = Op.Weight * FMath::Clamp(Op.Slope * Shaped, Op.ClampMin, Op.ClampMax);
+			}
+			else
+			{
+				Value = Op.ElseValue;
+			}
+		}
+
+		Reward += Value;
+
+		if (OutBreakdown)
+		{
+			// Terms sharing a name are reported as one
+			TPair<FName, float>* Existing = OutBreakdown->Terms.FindByPredicate([&Op](const TPair<FName, float>& Term) { return Term.Key == Op.Name; });
+			if (Existing)
+			{
+				Existing->Value += Value;
+			}
+			else
+			{
+				OutBreakdown->Add(Op.Name, Value);
+			}
+		}
+	}
+
+	return Reward;
+}
@@ -0,0 +1,176 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RLTypes.h"
+#include "EliteRewardProgram.generated.h"
+
+/**
+ * Values a reward term can read, all derived from FEliteRewardContext
+ */
+UENUM(BlueprintType)
+enum class EEliteRewardInput : uint8
+{
+	DistanceToPlayer UMETA(ToolTip = "Distance to the player normalized by max attack range, clamped [0,1]"),
+	DeltaDistance UMETA(ToolTip = "Change in actual distance to the player since the last step (units)"),
+	DeltaDistanceNormalized UMETA(ToolTip = "DeltaDistance divided by max attack range"),
+	BeyondMaxRange UMETA(ToolTip = "1 if the player is out of attack range"),
+	LineOfSight UMETA(ToolTip = "1 if the player is visible"),
+	TookDamageRecently UMETA(ToolTip = "1 if damaged in the last second"),
+	DeltaHealth UMETA(ToolTip = "Change in own health percentage since the last step"),
+	NumNearbyAllies UMETA(ToolTip = "Allies within 1000 units, normalized by 5"),
+	DistanceToClosestAlly UMETA(ToolTip = "Distance to the closest ally normalized by 2000"),
+	AllyCover UMETA(ToolTip = "DistanceToPlayer - DistanceToClosestAlly (positive when an ally is closer than the player)"),
+	AverageAllyHealth UMETA(ToolTip = "Mean health of the three closest allies"),
+	DPS UMETA(ToolTip = "Average damage per second over the last 5 seconds"),
+	DeltaDPS UMETA(ToolTip = "Change in DPS since the last step"),
+	HPS UMETA(ToolTip = "Average healing per second over the last 5 seconds"),
+	DeltaHPS UMETA(ToolTip = "Change in HPS since the last step"),
+	ActivePoisons UMETA(ToolTip = "Poison effects running on the player"),
+	AttackReady UMETA(ToolTip = "1 if not attacking or on cooldown"),
+	LastActionPrimary UMETA(ToolTip = "1 if the rewarded action was the primary attack"),
+	LastActionSecondary UMETA(ToolTip = "1 if the rewarded action was the secondary attack"),
+	LastActionStrafe UMETA(ToolTip = "1 if the rewarded action was a strafe"),
+	ProtectedAlliesShielded UMETA(ToolTip = "Protected allies this elite stands between the player and"),
+	ProtectedAlliesGuarded UMETA(ToolTip = "Protected allies within 700 units that are further from the player than this elite"),
+	Count UMETA(Hidden)
+};
+
+/**
+ * How a term turns its input into a value (before slope, clamp and weight)
+ */
+UENUM(BlueprintType)
+enum class EEliteRewardShape : uint8
+{
+	Constant UMETA(ToolTip = "1 (the term is just its weight when the conditions hold)"),
+	Linear UMETA(ToolTip = "Input"),
+	RampBelow UMETA(ToolTip = "max(0, Threshold - Input)"),
+	RampAbove UMETA(ToolTip = "max(0, Input - Threshold)")
+};
+
+/**
+ * Inclusive range test on one input
+ */
+USTRUCT(BlueprintType)
+struct FEliteRewardCondition
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward")
+	EEliteRewardInput Input = EEliteRewardInput::DistanceToPlayer;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward")
+	float Min = -1.0e6f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward")
+	float Max = 1.0e6f;
+};
+
+/**
+ * One additive reward term:
+ *   Conditions fail -> 0
+ *   Tests fail      -> ElseValue
+ *   otherwise       -> Weight * Clamp(Slope * Shape(Input))
+ */
+USTRUCT(BlueprintType)
+struct FEliteRewardTerm
+{
+	GENERATED_BODY()
+
+	/** Label for the debug breakdown (terms may share a label) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward")
+	EEliteRewardShape Shape = EEliteRewardShape::Constant;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward", meta = (EditCondition = "Shape != EEliteRewardShape::Constant"))
+	EEliteRewardInput Input = EEliteRewardInput::DistanceToPlayer;
+
+	/** Band edge for the ramp shapes */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward", meta = (EditCondition = "Shape == EEliteRewardShape::RampBelow || Shape == EEliteRewardShape::RampAbove"))
+	float Threshold = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward")
+	float Slope = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward")
+	bool bClamp = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward", meta = (EditCondition = "bClamp"))
+	float ClampMin = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward", meta = (EditCondition = "bClamp"))
+	float ClampMax = 1.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward")
+	float Weight = 1.0f;
+
+	/** All must hold for the term to apply at all */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward")
+	TArray<FEliteRewardCondition> Conditions;
+
+	/** When the conditions hold but any of these fails, the term is ElseValue instead */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward")
+	TArray<FEliteRewardCondition> Tests;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Reward")
+	float ElseValue = 0.0f;
+};
+
+/**
+ * Reward terms compiled into a flat program. Only the inputs the terms read are extracted,
+ * laid out one column per input (structure of arrays), so a whole batch of elites is evaluated
+ * one term at a time with branch-free loops over contiguous floats.
+ */
+class SOULSTRIKE_API FEliteRewardProgram
+{
+public:
+	/** Compile terms (replaces the previous program) */
+	void Compile(const TArray<FEliteRewardTerm>& Terms);
+
+	bool IsEmpty() const { return Ops.Num() == 0; }
+
+	/** Evaluate the program for a batch of elites */
+	void Evaluate(TArrayView<const FEliteRewardContext* const> Contexts, TArrayView<float> OutRewards) const;
+
+	/** Evaluate for one elite, optionally recording every term */
+	float EvaluateOne(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown) const;
+
+	/** Read one input from a context */
+	static float ReadInput(const FEliteRewardContext& Context, EEliteRewardInput Input);
+
+private:
+	struct FCondition
+	{
+		int32 Column;
+		float Min;
+		float Max;
+	};
+
+	struct FOp
+	{
+		EEliteRewardShape Shape;
+		int32 Column;
+		int32 FirstCondition;
+		int32 NumConditions;
+		int32 FirstTest;
+		int32 NumTests;
+		float Threshold;
+		float Slope;
+		float ClampMin;
+		float ClampMax;
+		float Weight;
+		float ElseValue;
+		FName Name;
+	};
+
+	int32 GetOrAddColumn(EEliteRewardInput Input);
+
+	/** Input read by each column */
+	TArray<EEliteRewardInput> Columns;
+
+	/** Conditions and tests of all ops, referenced by range */
+	TArray<FCondition> Conditions;
+
+	TArray<FOp> Ops;
+};
@@ -0,0 +1,553 @@
+#include "EliteRewards.h"
+#include "EliteArchetypeRegistry.h"
+
+static bool IsProtectedAlly(const FEliteRewardAlly& Ally)
+{
+	return (Ally.RoleFlags & (int32)EEliteRoleFlags::ProtectedAlly) != 0;
+}
+
+float EliteRewards::None(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown)
+{
+	// Base reward is 0. Override in subclasses.
+	return 0.0f;
+}
+
+float EliteRewards::Archer(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown)
+{
+	const FRLState& CurrentState = Context.CurrentState;
+	const float MaxAttackRange = Context.MaxAttackRange;
+
+	float DistNorm = CurrentState.DistanceToPlayer;
+	float DeltaDistance = Context.GetDeltaDistance();
+
+	// Reward staying within ~0.95 of max attack range, punish being too close or too far
+	bool bInKiteBand = (DistNorm >= 0.9f && DistNorm <= 1.0f && !CurrentState.bIsBeyondMaxRange);
+	bool bTooClose = DistNorm < 0.75f;
+	bool bTooFar = DistNorm > 1.1f;
+
+	// Component contributions
+	float R_PosBand = 0.f;
+	float R_MoveAdjust = 0.f;
+	float R_AttackTiming = 0.f;
+	float R_DPSBase = 0.f;
+	float R_DPSDelta = 0.f;
+	float R_Survival = 0.f;
+	float R_Cover = 0.f;
+	float R_LOS = 0.f;
+	float R_IdlePenalty = 0.f;
+
+	// Positive reward for being in kiting distance band, else negative
+	if (bInKiteBand) R_PosBand += 1.5f;
+	else {
+		if (bTooClose) R_PosBand -= (0.75f - DistNorm) * 1.0f;
+		if (bTooFar) R_PosBand -= (DistNorm - 1.1f) * 0.5f;
+	}
+
+	if (bTooClose && DeltaDistance > 0.0f)
+		R_MoveAdjust += FMath::Min(0.5f, DeltaDistance / MaxAttackRange * 2.0f);
+	if (bTooFar && DeltaDistance < 0.0f)
+		R_MoveAdjust += FMath::Min(0.5f, -DeltaDistance / MaxAttackRange * 2.0f);
+
+	if (Context.LastAction == EEliteAction::Primary_Attack)
+		R_AttackTiming += (bInKiteBand && CurrentState.bHasLineOfSightToPlayer) ? 1.0f : -0.5f;
+
+	// DPS-based rewards
+	float DeltaDPS = Context.CurrentDPS - Context.PreviousDPS;
+	R_DPSBase += FMath::Clamp(Context.CurrentDPS * 0.5f, 0.0f, 1.0f);
+	R_DPSDelta += FMath::Clamp(DeltaDPS * 1.0f, -1.0f, 1.0f);
+
+	float DeltaHealth = CurrentState.SelfHealthPercentage - Context.PreviousState.SelfHealthPercentage;
+	R_Survival += DeltaHealth * 2.0f;
+	if (CurrentState.bTookDamageRecently && bTooClose)
+		R_Survival -= 0.5f;
+
+	if (CurrentState.NumNearbyAllies > 0.2f && CurrentState.DistanceToClosestAlly < DistNorm)
+		R_Cover += 0.4f;
+	if (bInKiteBand && CurrentState.bHasLineOfSightToPlayer)
+		R_LOS += 0.3f;
+
+	if (!bInKiteBand && FMath::Abs(DeltaDistance) < 5.f)
+		R_IdlePenalty -= 0.1f;
+
+	if (OutBreakdown)
+	{
+		OutBreakdown->Add(TEXT("Pos"), R_PosBand);
+		OutBreakdown->Add(TEXT("Move"), R_MoveAdjust);
+		OutBreakdown->Add(TEXT("Attack"), R_AttackTiming);
+		OutBreakdown->Add(TEXT("DPS"), R_DPSBase);
+		OutBreakdown->Add(TEXT("dDPS"), R_DPSDelta);
+		OutBreakdown->Add(TEXT("Survival"), R_Survival);
+		OutBreakdown->Add(TEXT("Cover"), R_Cover);
+		OutBreakdown->Add(TEXT("LOS"), R_LOS);
+		OutBreakdown->Add(TEXT("Idle"), R_IdlePenalty);
+	}
+
+	return R_PosBand + R_MoveAdjust + R_AttackTiming + R_DPSBase + R_DPSDelta + R_Survival + R_Cover + R_LOS + R_IdlePenalty;
+}
+
+float EliteRewards::Assassin(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown)
+{
+	const FRLState& CurrentState = Context.CurrentState;
+	const float MaxAttackRange = Context.MaxAttackRange;
+	const EEliteAction LastAction = Context.LastAction;
+
+	float DistNorm = CurrentState.DistanceToPlayer;
+	float DeltaDistance = Context.GetDeltaDistance();
+
+	bool bPoisonActive = Context.NumActivePoisons > 0;
+	bool bDiveBand = DistNorm <= 0.7f && !CurrentState.bIsBeyondMaxRange; // Go in for attack
+	bool bRetreatBand = DistNorm >= 0.9f && DistNorm <= 1.2f; // Retreat while debuff active
+	bool bTooFar = DistNorm > 1.3f;
+
+	float R_Dive=0,R_Retreat=0,R_Move=0,R_Attack=0,R_DPSBase=0,R_DPSDelta=0,R_Poison=0,R_Survive=0,R_Strafe=0,R_Camp=0;
+
+	if (bPoisonActive)
+		R_Retreat += bRetreatBand ? 1.0f : 0.f;
+	else
+		R_Dive += bDiveBand ? 0.8f : 0.f;
+
+	if (!bPoisonActive && !bDiveBand && DeltaDistance < 0.0f) R_Move += FMath::Min(0.4f, -DeltaDistance / MaxAttackRange * 2.0f);
+	if (bPoisonActive && DistNorm < 0.8f && DeltaDistance > 0.0f) R_Move += FMath::Min(0.4f, DeltaDistance / MaxAttackRange * 2.0f);
+
+	// Reward attacking when debuff not active
+	if (LastAction == EEliteAction::Primary_Attack)
+	{
+		if (!bPoisonActive && bDiveBand && Context.AttackState == EAttackState::Normal) R_Attack += 0.9f; else R_Attack -= 0.4f;
+	}
+
+	// Reward DPS
+	float DeltaDPS = Context.CurrentDPS - Context.PreviousDPS;
+	R_DPSBase += FMath::Clamp(Context.CurrentDPS * 0.6f, 0.f, 1.2f);
+	R_DPSDelta += FMath::Clamp(DeltaDPS * 1.2f, -1.0f, 1.0f);
+	R_Poison += Context.NumActivePoisons * 0.3f;
+
+	// Survival reward
+	float DeltaHealth = CurrentState.SelfHealthPercentage - Context.PreviousState.SelfHealthPercentage;
+	R_Survive += DeltaHealth * 2.0f;
+	if (CurrentState.bTookDamageRecently && !bPoisonActive && !bDiveBand) R_Survive -= 0.3f;
+
+	if (bDiveBand && (LastAction == EEliteAction::Strafe_Left || LastAction == EEliteAction::Strafe_Right)) R_Strafe += 0.3f;
+	if (bTooFar) R_Camp -= (DistNorm - 1.3f) * 0.8f;
+
+	if (OutBreakdown)
+	{
+		OutBreakdown->Add(TEXT("Dive"), R_Dive);
+		OutBreakdown->Add(TEXT("Retreat"), R_Retreat);
+		OutBreakdown->Add(TEXT("Move"), R_Move);
+		OutBreakdown->Add(TEXT("Attack"), R_Attack);
+		OutBreakdown->Add(TEXT("DPS"), R_DPSBase);
+		OutBreakdown->Add(TEXT("dDPS"), R_DPSDelta);
+		OutBreakdown->Add(TEXT("Poison"), R_Poison);
+		OutBreakdown->Add(TEXT("Survival"), R_Survive);
+		OutBreakdown->Add(TEXT("Strafe"), R_Strafe);
+		OutBreakdown->Add(TEXT("Camp"), R_Camp);
+	}
+
+	return R_Dive + R_Retreat + R_Move + R_Attack + R_DPSBase + R_DPSDelta + R_Poison + R_Survive + R_Strafe + R_Camp;
+}
+
+float EliteRewards::Giant(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown)
+{
+	const FRLState& CurrentState = Context.CurrentState;
+	const float MaxAttackRange = Context.MaxAttackRange;
+
+	float DistNorm = CurrentState.DistanceToPlayer;
+	float DeltaDistance = Context.GetDeltaDistance();
+	bool bInTankBand = DistNorm <= 0.6f && !CurrentState.bIsBeyondMaxRange;
+	bool bFar = DistNorm > 0.9f;
+
+	float R_Pos = 0.f;
+	float R_Move = 0.f;
+	float R_Attack = 0.f;
+	float R_DPSBase = 0.f;
+	float R_DPSDelta = 0.f;
+	float R_Tank = 0.f;
+	float R_Block = 0.f;
+	float R_Cohesion = 0.f;
+	float R_Camping = 0.f;
+
+	// Reward being in "tanking" position
+	R_Pos += bInTankBand ? 1.0f : 0.0f;
+	if (bFar) R_Camping -= (DistNorm - 0.9f) * 1.0f;
+
+	// Movement toward player when far
+	if (bFar && DeltaDistance < 0.0f) R_Move += FMath::Min(0.5f, -DeltaDistance / MaxAttackRange * 2.0f);
+
+	// Reward attacking when in range
+	if (Context.LastAction == EEliteAction::Primary_Attack)
+	{
+		if (!CurrentState.bIsBeyondMaxRange && Context.AttackState == EAttackState::Normal)
+			R_Attack += 0.8f; // encourage frequent melee attacks
+		else
+			R_Attack -= 0.3f;
+	}
+
+	// DPS rewards
+	float DeltaDPS = Context.CurrentDPS - Context.PreviousDPS;
+	R_DPSBase += FMath::Clamp(Context.CurrentDPS * 0.3f, 0.f, 0.6f);
+	R_DPSDelta += FMath::Clamp(DeltaDPS * 0.8f, -0.6f, 0.6f);
+
+	float DeltaHealth = CurrentState.SelfHealthPercentage - Context.PreviousState.SelfHealthPercentage;
+	R_Tank += DeltaHealth * 3.0f;
+	if (CurrentState.bTookDamageRecently && bInTankBand) R_Tank += 0.5f;
+
+	// Body blocking/Tanking for archer/healer
+	for (const FEliteRewardAlly& Ally : Context.ClosestAllies)
+	{
+		if (IsProtectedAlly(Ally))
+		{
+			if (Ally.DistanceToSelf < Ally.DistanceToPlayer && DistNorm < Ally.DistanceToPlayer / MaxAttackRange)
+			{
+				R_Block += 0.6f;
+			}
+		}
+	}
+
+	R_Cohesion += CurrentState.NumNearbyAllies * (bInTankBand ? 0.3f : 0.1f);
+
+	if (OutBreakdown)
+	{
+		OutBreakdown->Add(TEXT("Pos"), R_Pos);
+		OutBreakdown->Add(TEXT("Move"), R_Move);
+		OutBreakdown->Add(TEXT("Attack"), R_Attack);
+		OutBreakdown->Add(TEXT("DPS"), R_DPSBase);
+		OutBreakdown->Add(TEXT("dDPS"), R_DPSDelta);
+		OutBreakdown->Add(TEXT("Tank"), R_Tank);
+		OutBreakdown->Add(TEXT("Block"), R_Block);
+		OutBreakdown->Add(TEXT("Cohesion"), R_Cohesion);
+		OutBreakdown->Add(TEXT("Camp"), R_Camping);
+	}
+
+	return R_Pos + R_Move + R_Attack + R_DPSBase + R_DPSDelta + R_Tank + R_Block + R_Cohesion + R_Camping;
+}
+
+float EliteRewards::Healer(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown)
+{
+	const FRLState& CurrentState = Context.CurrentState;
+	const float MaxAttackRange = Context.MaxAttackRange;
+	const EEliteAction LastAction = Context.LastAction;
+
+	float DistNorm = CurrentState.DistanceToPlayer;
+	float DeltaDistance = Context.GetDeltaDistance();
+	bool bSafeBand = DistNorm >= 0.85f;
+	bool bTooClose = DistNorm < 0.6f;
+	bool bDanger = DistNorm < 0.4f;
+
+	float R_Pos=0,R_Move=0,R_HealBase=0,R_HealDelta=0,R_AttackPenalty=0,R_Survive=0,R_AllyNeed=0,R_Cover=0,R_DPSNeg=0;
+
+	if (bSafeBand) R_Pos += 0.8f;
+	if (bTooClose) R_Pos -= (0.6f - DistNorm) * 1.0f;
+	if (bDanger) R_Pos -= 0.8f;
+
+	// Stay "safe" (away from player) but prio healing
+	if (bTooClose && DeltaDistance > 0.0f) R_Move += FMath::Min(0.5f, DeltaDistance / MaxAttackRange * 2.0f);
+	if (bSafeBand && DeltaDistance > 0.0f && CurrentState.DistanceToClosestAlly > DistNorm) R_Move -= 0.2f; // drifting away from allies unnecessarily
+
+	// Reward healing
+	float DeltaHPS = Context.CurrentHPS - Context.PreviousHPS;
+	R_HealBase += FMath::Clamp(Context.CurrentHPS * 1.2f, 0.f, 2.0f);
+	R_HealDelta += FMath::Clamp(DeltaHPS * 2.0f, -1.5f, 1.5f);
+
+	// Don't want healer to attack often
+	R_DPSNeg -= FMath::Clamp(Context.CurrentDPS * 0.3f, 0.f, 1.0f);
+	if (LastAction == EEliteAction::Primary_Attack) R_AttackPenalty -= 0.5f;
+	if (LastAction == EEliteAction::Secondary_Attack && !bTooClose) R_HealBase += 0.6f;
+
+	// Stay alive
+	float DeltaHealth = CurrentState.SelfHealthPercentage - Context.PreviousState.SelfHealthPercentage;
+	R_Survive += DeltaHealth * 3.0f;
+	if (CurrentState.bTookDamageRecently) R_Survive -= 0.4f;
+
+	// Ally survival
+	float AvgAllyHealth = (CurrentState.HealthOfClosestAlly + CurrentState.HealthOfSecondClosestAlly + CurrentState.HealthOfThirdClosestAlly) / 3.0f;
+	if (AvgAllyHealth < 0.7f && CurrentState.NumNearbyAllies > 0.0f) R_AllyNeed += 0.6f;
+	if (CurrentState.NumNearbyAllies > 0.0f && CurrentState.DistanceToClosestAlly < DistNorm) R_Cover += 0.4f;
+
+	if (OutBreakdown)
+	{
+		OutBreakdown->Add(TEXT("Pos"), R_Pos);
+		OutBreakdown->Add(TEXT("Move"), R_Move);
+		OutBreakdown->Add(TEXT("Heal"), R_HealBase);
+		OutBreakdown->Add(TEXT("dHeal"), R_HealDelta);
+		OutBreakdown->Add(TEXT("AtkPen"), R_AttackPenalty);
+		OutBreakdown->Add(TEXT("Survive"), R_Survive);
+		OutBreakdown->Add(TEXT("AllyNeed"), R_AllyNeed);
+		OutBreakdown->Add(TEXT("Cover"), R_Cover);
+		OutBreakdown->Add(TEXT("DPSNeg"), R_DPSNeg);
+	}
+
+	return R_Pos + R_Move + R_HealBase + R_HealDelta + R_AttackPenalty + R_Survive + R_AllyNeed + R_Cover + R_DPSNeg;
+}
+
+float EliteRewards::Paladin(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown)
+{
+	const FRLState& CurrentState = Context.CurrentState;
+	const float MaxAttackRange = Context.MaxAttackRange;
+
+	float DistNorm = CurrentState.DistanceToPlayer;
+	float DeltaDistance = Context.GetDeltaDistance();
+	bool bInFrontlineBand = (DistNorm >= 0.4f && DistNorm <= 0.8f && !CurrentState.bIsBeyondMaxRange);
+	bool bTooFar = DistNorm > 1.1f;
+	bool bTooClose = DistNorm < 0.3f;
+
+	float R_Pos=0, R_Move=0, R_Attack=0, R_DPSBase=0, R_DPSDelta=0, R_Survive=0, R_Guard=0, R_Cohesion=0, R_Camping=0;
+
+	// Reward "frontlining" (tanking for other elites), stay close to player
+	R_Pos += bInFrontlineBand ? 1.0f : 0.0f;
+	if (bTooFar) R_Camping -= (DistNorm - 1.1f) * 0.8f;
+	if (bTooClose) R_Pos -= (0.3f - DistNorm) * 0.5f;
+
+	if (!bInFrontlineBand && DistNorm > 0.8f && DeltaDistance < 0.0f) R_Move += FMath::Min(0.4f, -DeltaDistance / MaxAttackRange * 2.0f);
+	if (!bInFrontlineBand && bTooClose && DeltaDistance > 0.0f) R_Move += FMath::Min(0.4f, DeltaDistance / MaxAttackRange * 2.0f);
+
+	// Reward melee attacks
+	if (Context.LastAction == EEliteAction::Primary_Attack)
+	{
+		if (!CurrentState.bIsBeyondMaxRange && Context.AttackState == EAttackState::Normal)
+			R_Attack += 0.7f; // reward melee swings
+		else
+			R_Attack -= 0.3f;
+	}
+
+	// Reward DPS
+	float DeltaDPS = Context.CurrentDPS - Context.PreviousDPS;
+	R_DPSBase += FMath::Clamp(Context.CurrentDPS * 0.4f, 0.f, 0.8f);
+	R_DPSDelta += FMath::Clamp(DeltaDPS * 0.8f, -0.6f, 0.6f);
+
+	// Stay alive
+	float DeltaHealth = CurrentState.SelfHealthPercentage - Context.PreviousState.SelfHealthPercentage;
+	R_Survive += DeltaHealth * 3.0f;
+	if (CurrentState.bTookDamageRecently && bInFrontlineBand) R_Survive += 0.4f;
+
+	// Tank/protect healer/archer
+	for (const FEliteRewardAlly& Ally : Context.ClosestAllies)
+	{
+		if (IsProtectedAlly(Ally))
+		{
+			if (Ally.DistanceToSelf <= 700.0f && DistNorm * MaxAttackRange < Ally.DistanceToPlayer) R_Guard += 0.7f;
+		}
+	}
+
+	R_Cohesion += CurrentState.NumNearbyAllies * 0.2f;
+
+	if (OutBreakdown)
+	{
+		OutBreakdown->Add(TEXT("Pos"), R_Pos);
+		OutBreakdown->Add(TEXT("Move"), R_Move);
+		OutBreakdown->Add(TEXT("Attack"), R_Attack);
+		OutBreakdown->Add(TEXT("DPS"), R_DPSBase);
+		OutBreakdown->Add(TEXT("dDPS"), R_DPSDelta);
+		OutBreakdown->Add(TEXT("Survive"), R_Survive);
+		OutBreakdown->Add(TEXT("Guard"), R_Guard);
+		OutBreakdown->Add(TEXT("Cohesion"), R_Cohesion);
+		OutBreakdown->Add(TEXT("Camp"), R_Camping);
+	}
+
+	return R_Pos + R_Move + R_Attack + R_DPSBase + R_DPSDelta + R_Survive + R_Guard + R_Cohesion + R_Camping;
+}
+
+// ========== DEFAULT TERM TABLES ==========
+
+namespace EliteRewardTables
+{
+	using EInput = EEliteRewardInput;
+
+	/** Turns strict comparisons into inclusive ranges */
+	const float Eps = 1.0e-4f;
+
+	FEliteRewardCondition Range(EInput Input, float Min, float Max)
+	{
+		FEliteRewardCondition Condition;
+		Condition.Input = Input;
+		Condition.Min = Min;
+		Condition.Max = Max;
+		return Condition;
+	}
+
+	FEliteRewardCondition AtLeast(EInput Input, float Min) { return Range(Input, Min, 1.0e6f); }
+	FEliteRewardCondition AtMost(EInput Input, float Max) { return Range(Input, -1.0e6f, Max); }
+	FEliteRewardCondition IsSet(EInput Input) { return AtLeast(Input, 0.5f); }
+	FEliteRewardCondition IsClear(EInput Input) { return AtMost(Input, 0.5f); }
+
+	/** Fluent builder for one term */
+	struct FTerm
+	{
+		FEliteRewardTerm Term;
+
+		FTerm(const TCHAR* Name, float Weight)
+		{
+			Term.Name = Name;
+			Term.Weight = Weight;
+		}
+
+		FTerm& Linear(EInput Input, float Slope = 1.0f)
+		{
+			Term.Shape = EEliteRewardShape::Linear;
+			Term.Input = Input;
+			Term.Slope = Slope;
+			return *this;
+		}
+
+		FTerm& Below(EInput Input, float Threshold, float Slope = 1.0f)
+		{
+			Linear(Input, Slope);
+			Term.Shape = EEliteRewardShape::RampBelow;
+			Term.Threshold = Threshold;
+			return *this;
+		}
+
+		FTerm& Above(EInput Input, float Threshold, float Slope = 1.0f)
+		{
+			Linear(Input, Slope);
+			Term.Shape = EEliteRewardShape::RampAbove;
+			Term.Threshold = Threshold;
+			return *this;
+		}
+
+		FTerm& Clamp(float Min, float Max)
+		{
+			Term.bClamp = true;
+			Term.ClampMin = Min;
+			Term.ClampMax = Max;
+			return *this;
+		}
+
+		FTerm& When(const FEliteRewardCondition& Condition)
+		{
+			Term.Conditions.Add(Condition);
+			return *this;
+		}
+
+		FTerm& Test(const FEliteRewardCondition& Condition)
+		{
+			Term.Tests.Add(Condition);
+			return *this;
+		}
+
+		FTerm& Else(float Value)
+		{
+			Term.ElseValue = Value;
+			return *this;
+		}
+
+		operator FEliteRewardTerm() const { return Term; }
+	};
+
+	// Note the normalized distance is clamped to [0,1] and is exactly 1 whenever the player is
+	// beyond max range, so "not in a band below 1" reduces to a single distance threshold.
+
+	TArray<FEliteRewardTerm> ArcherTerms()
+	{
+		return {
+			FTerm(TEXT("Pos"), 1.5f).When(Range(EInput::DistanceToPlayer, 0.9f, 1.0f)).When(IsClear(EInput::BeyondMaxRange)),
+			FTerm(TEXT("Pos"), -1.0f).Below(EInput::DistanceToPlayer, 0.75f),
+			FTerm(TEXT("Pos"), -1.0f).Above(EInput::DistanceToPlayer, 1.1f, 0.5f),
+			FTerm(TEXT("Move"), 1.0f).Linear(EInput::DeltaDistanceNormalized, 2.0f).Clamp(0.0f, 0.5f).When(AtMost(EInput::DistanceToPlayer, 0.75f - Eps)),
+			FTerm(TEXT("Move"), 1.0f).Linear(EInput::DeltaDistanceNormalized, -2.0f).Clamp(0.0f, 0.5f).When(AtLeast(EInput::DistanceToPlayer, 1.1f + Eps)),
+			FTerm(TEXT("Attack"), 1.0f).When(IsSet(EInput::LastActionPrimary))
+				.Test(Range(EInput::DistanceToPlayer, 0.9f, 1.0f)).Test(IsClear(EInput::BeyondMaxRange)).Test(IsSet(EInput::LineOfSight)).Else(-0.5f),
+			FTerm(TEXT("DPS"), 1.0f).Linear(EInput::DPS, 0.5f).Clamp(0.0f, 1.0f),
+			FTerm(TEXT("dDPS"), 1.0f).Linear(EInput::DeltaDPS, 1.0f).Clamp(-1.0f, 1.0f),
+			FTerm(TEXT("Survival"), 1.0f).Linear(EInput::DeltaHealth, 2.0f),
+			FTerm(TEXT("Survival"), -0.5f).When(IsSet(EInput::TookDamageRecently)).When(AtMost(EInput::DistanceToPlayer, 0.75f - Eps)),
+			// NumNearbyAllies moves in steps of 0.2, so "> 0.2" is ">= 0.4"
+			FTerm(TEXT("Cover"), 0.4f).When(AtLeast(EInput::NumNearbyAllies, 0.3f)).When(AtLeast(EInput::AllyCover, Eps)),
+			FTerm(TEXT("LOS"), 0.3f).When(Range(EInput::DistanceToPlayer, 0.9f, 1.0f)).When(IsClear(EInput::BeyondMaxRange)).When(IsSet(EInput::LineOfSight)),
+			FTerm(TEXT("Idle"), -0.1f).When(AtMost(EInput::DistanceToPlayer, 0.9f - Eps)).When(Range(EInput::DeltaDistance, -5.0f + Eps, 5.0f - Eps)),
+			FTerm(TEXT("Idle"), -0.1f).When(IsSet(EInput::BeyondMaxRange)).When(Range(EInput::DeltaDistance, -5.0f + Eps, 5.0f - Eps)),
+		};
+	}
+
+	TArray<FEliteRewardTerm> AssassinTerms()
+	{
+		return {
+			FTerm(TEXT("Dive"), 0.8f).When(IsClear(EInput::ActivePoisons)).When(AtMost(EInput::DistanceToPlayer, 0.7f)).When(IsClear(EInput::BeyondMaxRange)),
+			FTerm(TEXT("Retreat"), 1.0f).When(IsSet(EInput::ActivePoisons)).When(Range(EInput::DistanceToPlayer, 0.9f, 1.2f)),
+			FTerm(TEXT("Move"), 1.0f).Linear(EInput::DeltaDistanceNormalized, -2.0f).Clamp(0.0f, 0.4f)
+				.When(IsClear(EInput::ActivePoisons)).When(AtLeast(EInput::DistanceToPlayer, 0.7f + Eps)),
+			FTerm(TEXT("Move"), 1.0f).Linear(EInput::DeltaDistanceNormalized, 2.0f).Clamp(0.0f, 0.4f)
+				.When(IsSet(EInput::ActivePoisons)).When(AtMost(EInput::DistanceToPlayer, 0.8f - Eps)),
+			FTerm(TEXT("Attack"), 0.9f).When(IsSet(EInput::LastActionPrimary))
+				.Test(IsClear(EInput::ActivePoisons)).Test(AtMost(EInput::DistanceToPlayer, 0.7f)).Test(IsClear(EInput::BeyondMaxRange))
+				.Test(IsSet(EInput::AttackReady)).Else(-0.4f),
+			FTerm(TEXT("DPS"), 1.0f).Linear(EInput::DPS, 0.6f).Clamp(0.0f, 1.2f),
+			FTerm(TEXT("dDPS"), 1.0f).Linear(EInput::DeltaDPS, 1.2f).Clamp(-1.0f, 1.0f),
+			FTerm(TEXT("Poison"), 1.0f).Linear(EInput::ActivePoisons, 0.3f),
+			FTerm(TEXT("Survival"), 1.0f).Linear(EInput::DeltaHealth, 2.0f),
+			FTerm(TEXT("Survival"), -0.3f).When(IsSet(EInput::TookDamageRecently)).When(IsClear(EInput::ActivePoisons)).When(AtLeast(EInput::DistanceToPlayer, 0.7f + Eps)),
+			FTerm(TEXT("Strafe"), 0.3f).When(AtMost(EInput::DistanceToPlayer, 0.7f)).When(IsClear(EInput::BeyondMaxRange)).When(IsSet(EInput::LastActionStrafe)),
+			FTerm(TEXT("Camp"), -1.0f).Above(EInput::DistanceToPlayer, 1.3f, 0.8f),
+		};
+	}
+
+	TArray<FEliteRewardTerm> GiantTerms()
+	{
+		return {
+			FTerm(TEXT("Pos"), 1.0f).When(AtMost(EInput::DistanceToPlayer, 0.6f)).When(IsClear(EInput::BeyondMaxRange)),
+			FTerm(TEXT("Move"), 1.0f).Linear(EInput::DeltaDistanceNormalized, -2.0f).Clamp(0.0f, 0.5f).When(AtLeast(EInput::DistanceToPlayer, 0.9f + Eps)),
+			FTerm(TEXT("Attack"), 0.8f).When(IsSet(EInput::LastActionPrimary))
+				.Test(IsClear(EInput::BeyondMaxRange)).Test(IsSet(EInput::AttackReady)).Else(-0.3f),
+			FTerm(TEXT("DPS"), 1.0f).Linear(EInput::DPS, 0.3f).Clamp(0.0f, 0.6f),
+			FTerm(TEXT("dDPS"), 1.0f).Linear(EInput::DeltaDPS, 0.8f).Clamp(-0.6f, 0.6f),
+			FTerm(TEXT("Tank"), 1.0f).Linear(EInput::DeltaHealth, 3.0f),
+			FTerm(TEXT("Tank"), 0.5f).When(IsSet(EInput::TookDamageRecently)).When(AtMost(EInput::DistanceToPlayer, 0.6f)).When(IsClear(EInput::BeyondMaxRange)),
+			FTerm(TEXT("Block"), 1.0f).Linear(EInput::ProtectedAlliesShielded, 0.6f),
+			FTerm(TEXT("Cohesion"), 1.0f).Linear(EInput::NumNearbyAllies, 0.1f),
+			FTerm(TEXT("Cohesion"), 1.0f).Linear(EInput::NumNearbyAllies, 0.2f).When(AtMost(EInput::DistanceToPlayer, 0.6f)).When(IsClear(EInput::BeyondMaxRange)),
+			FTerm(TEXT("Camp"), -1.0f).Above(EInput::DistanceToPlayer, 0.9f),
+		};
+	}
+
+	TArray<FEliteRewardTerm> HealerTerms()
+	{
+		return {
+			FTerm(TEXT("Pos"), 0.8f).When(AtLeast(EInput::DistanceToPlayer, 0.85f)),
+			FTerm(TEXT("Pos"), -1.0f).Below(EInput::DistanceToPlayer, 0.6f),
+			FTerm(TEXT("Pos"), -0.8f).When(AtMost(EInput::DistanceToPlayer, 0.4f - Eps)),
+			FTerm(TEXT("Move"), 1.0f).Linear(EInput::DeltaDistanceNormalized, 2.0f).Clamp(0.0f, 0.5f).When(AtMost(EInput::DistanceToPlayer, 0.6f - Eps)),
+			// Drifting away from allies unnecessarily
+			FTerm(TEXT("Move"), -0.2f).When(AtLeast(EInput::DistanceToPlayer, 0.85f)).When(AtLeast(EInput::DeltaDistance, Eps)).When(AtMost(EInput::AllyCover, -Eps)),
+			FTerm(TEXT("Heal"), 1.0f).Linear(EInput::HPS, 1.2f).Clamp(0.0f, 2.0f),
+			FTerm(TEXT("Heal"), 0.6f).When(IsSet(EInput::LastActionSecondary)).When(AtLeast(EInput::DistanceToPlayer, 0.6f)),
+			FTerm(TEXT("dHeal"), 1.0f).Linear(EInput::DeltaHPS, 2.0f).Clamp(-1.5f, 1.5f),
+			FTerm(TEXT("AtkPen"), -0.5f).When(IsSet(EInput::LastActionPrimary)),
+			FTerm(TEXT("Survive"), 1.0f).Linear(EInput::DeltaHealth, 3.0f),
+			FTerm(TEXT("Survive"), -0.4f).When(IsSet(EInput::TookDamageRecently)),
+			FTerm(TEXT("AllyNeed"), 0.6f).When(AtMost(EInput::AverageAllyHealth, 0.7f - Eps)).When(AtLeast(EInput::NumNearbyAllies, 0.1f)),
+			FTerm(TEXT("Cover"), 0.4f).When(AtLeast(EInput::NumNearbyAllies, 0.1f)).When(AtLeast(EInput::AllyCover, Eps)),
+			FTerm(TEXT("DPSNeg"), -1.0f).Linear(EInput::DPS, 0.3f).Clamp(0.0f, 1.0f),
+		};
+	}
+
+	TArray<FEliteRewardTerm> PaladinTerms()
+	{
+		return {
+			FTerm(TEXT("Pos"), 1.0f).When(Range(EInput::DistanceToPlayer, 0.4f, 0.8f)).When(IsClear(EInput::BeyondMaxRange)),
+			FTerm(TEXT("Pos"), -1.0f).Below(EInput::DistanceToPlayer, 0.3f, 0.5f),
+			FTerm(TEXT("Move"), 1.0f).Linear(EInput::DeltaDistanceNormalized, -2.0f).Clamp(0.0f, 0.4f).When(AtLeast(EInput::DistanceToPlayer, 0.8f + Eps)),
+			FTerm(TEXT("Move"), 1.0f).Linear(EInput::DeltaDistanceNormalized, 2.0f).Clamp(0.0f, 0.4f).When(AtMost(EInput::DistanceToPlayer, 0.3f - Eps)),
+			FTerm(TEXT("Attack"), 0.7f).When(IsSet(EInput::LastActionPrimary))
+				.Test(IsClear(EInput::BeyondMaxRange)).Test(IsSet(EInput::AttackReady)).Else(-0.3f),
+			FTerm(TEXT("DPS"), 1.0f).Linear(EInput::DPS, 0.4f).Clamp(0.0f, 0.8f),
+			FTerm(TEXT("dDPS"), 1.0f).Linear(EInput::DeltaDPS, 0.8f).Clamp(-0.6f, 0.6f),
+			FTerm(TEXT("Survive"), 1.0f).Linear(EInput::DeltaHealth, 3.0f),
+			FTerm(TEXT("Survive"), 0.4f).When(IsSet(EInput::TookDamageRecently)).When(Range(EInput::DistanceToPlayer, 0.4f, 0.8f)).When(IsClear(EInput::BeyondMaxRange)),
+			FTerm(TEXT("Guard"), 1.0f).Linear(EInput::ProtectedAlliesGuarded, 0.7f),
+			FTerm(TEXT("Cohesion"), 1.0f).Linear(EInput::NumNearbyAllies, 0.2f),
+			FTerm(TEXT("Camp"), -1.0f).Above(EInput::DistanceToPlayer, 1.1f, 0.8f),
+		};
+	}
+}
+
+TArray<FEliteRewardTerm> EliteRewards::MakeDefaultTerms(EEliteType Type)
+{
+	switch (Type)
+	{
+	case EEliteType::Archer: return EliteRewardTables::ArcherTerms();
+	case EEliteType::Assassin: return EliteRewardTables::AssassinTerms();
+	case EEliteType::Giant: return EliteRewardTables::GiantTerms();
+	case EEliteType::Healer: return EliteRewardTables::HealerTerms();
+	case EEliteType::Paladin: return EliteRewardTables::PaladinTerms();
+	default: return TArray<FEliteRewardTerm>();
+	}
+}
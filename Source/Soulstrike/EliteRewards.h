@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RLTypes.h"
+#include "EliteRewardProgram.h"
+
+enum class EEliteType : uint8;
+
+/**
+ * Per-type elite rewards as pure functions over a captured FEliteRewardContext.
+ * They never touch actors or the world, so every elite's reward can be evaluated on worker
+ * threads, and the functions can be exercised headlessly with hand-built contexts.
+ */
+namespace EliteRewards
+{
+	/** Base elites earn nothing */
+	SOULSTRIKE_API float None(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown);
+
+	/** Kite at ~0.95 of max range with line of sight, hide behind allies */
+	SOULSTRIKE_API float Archer(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown);
+
+	/** Dive in to poison, retreat while the poison ticks */
+	SOULSTRIKE_API float Assassin(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown);
+
+	/** Hold a tanking position close to the player and body-block for protected allies */
+	SOULSTRIKE_API float Giant(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown);
+
+	/** Stay safe and keep allies healed */
+	SOULSTRIKE_API float Healer(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown);
+
+	/** Frontline in melee range and guard protected allies */
+	SOULSTRIKE_API float Paladin(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown);
+
+	/**
+	 * The rewards above as data-driven terms, used to seed archetypes that define none.
+	 * Compiled they give the same reward as the functions (strict comparisons become inclusive
+	 * ranges nudged by a small epsilon).
+	 */
+	SOULSTRIKE_API TArray<FEliteRewardTerm> MakeDefaultTerms(EEliteType Type);
+}
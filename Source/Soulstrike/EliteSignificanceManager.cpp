@@ -0,0 +1,228 @@
+#include "EliteSignificanceManager.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "HAL/IConsoleManager.h"
+
+static float GEliteSignificanceNearDistance = 2500.0f;
+static FAutoConsoleVariableRef CVarEliteSignificanceNearDistance(
+	TEXT("Soulstrike.AI.Significance.NearDistance"),
+	GEliteSignificanceNearDistance,
+	TEXT("Elites closer than this to the player (and on screen) are High significance."));
+
+static float GEliteSignificanceMidDistance = 6000.0f;
+static FAutoConsoleVariableRef CVarEliteSignificanceMidDistance(
+	TEXT("Soulstrike.AI.Significance.MidDistance"),
+	GEliteSignificanceMidDistance,
+	TEXT("Elites beyond this distance from the player are Low significance."));
+
+static float GEliteSignificanceHysteresis = 300.0f;
+static FAutoConsoleVariableRef CVarEliteSignificanceHysteresis(
+	TEXT("Soulstrike.AI.Significance.Hysteresis"),
+	GEliteSignificanceHysteresis,
+	TEXT("Distance past a band edge an elite must travel before it changes band."));
+
+static float GEliteSignificanceViewMargin = 10.0f;
+static FAutoConsoleVariableRef CVarEliteSignificanceViewMargin(
+	TEXT("Soulstrike.AI.Significance.ViewMarginDegrees"),
+	GEliteSignificanceViewMargin,
+	TEXT("Extra half-angle (degrees) an on-screen elite keeps before it counts as off screen."));
+
+static float GEliteMediumStepInterval = 0.2f;
+static FAutoConsoleVariableRef CVarEliteMediumStepInterval(
+	TEXT("Soulstrike.AI.Significance.MediumStepInterval"),
+	GEliteMediumStepInterval,
+	TEXT("Seconds between RL steps for Medium significance elites."));
+
+static float GEliteLowStepInterval = 1.0f;
+static FAutoConsoleVariableRef CVarEliteLowStepInterval(
+	TEXT("Soulstrike.AI.Significance.LowStepInterval"),
+	GEliteLowStepInterval,
+	TEXT("Seconds between RL steps for Low significance elites."));
+
+static float GEliteMediumLOSCacheScale = 3.0f;
+static FAutoConsoleVariableRef CVarEliteMediumLOSCacheScale(
+	TEXT("Soulstrike.AI.Significance.MediumLOSCacheScale"),
+	GEliteMediumLOSCacheScale,
+	TEXT("LOS cache threshold/age multiplier for Medium significance elites."));
+
+static float GEliteLowLOSCacheScale = 8.0f;
+static FAutoConsoleVariableRef CVarEliteLowLOSCacheScale(
+	TEXT("Soulstrike.AI.Significance.LowLOSCacheScale"),
+	GEliteLowLOSCacheScale,
+	TEXT("LOS cache threshold/age multiplier for Low significance elites."));
+
+static FAutoConsoleCommandWithWorld GEliteSignificanceCommand(
+	TEXT("Soulstrike.AI.Significance"),
+	TEXT("Print how many elites are in each significance tier."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&UEliteSignificanceManager::DumpTiers));
+
+UEliteSignificanceManager* UEliteSignificanceManager::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UEliteSignificanceManager>() : nullptr;
+}
+
+void UEliteSignificanceManager::Deinitialize()
+{
+	Entries.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEliteSignificanceManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEliteSignificanceManager, STATGROUP_Tickables);
+}
+
+void UEliteSignificanceManager::Register(const APawn* Elite)
+{
+	if (!Elite)
+		return;
+
+	FSignificanceEntry& Entry = Entries.FindOrAdd(FObjectKey(Elite));
+	Entry = FSignificanceEntry();
+	Entry.Elite = Elite;
+}
+
+void UEliteSignificanceManager::Unregister(const APawn* Elite)
+{
+	Entries.Remove(FObjectKey(Elite));
+}
+
+EEliteSignificance UEliteSignificanceManager::GetSignificance(const APawn* Elite) const
+{
+	const FSignificanceEntry* Entry = Entries.Find(FObjectKey(Elite));
+	return Entry ? Entry->Significance : EEliteSignificance::High;
+}
+
+float UEliteSignificanceManager::GetStepInterval(EEliteSignificance Significance)
+{
+	switch (Significance)
+	{
+	case EEliteSignificance::Medium: return GEliteMediumStepInterval;
+	case EEliteSignificance::Low: return GEliteLowStepInterval;
+	default: return 0.0f;
+	}
+}
+
+float UEliteSignificanceManager::GetLineOfSightCacheScale(EEliteSignificance Significance)
+{
+	switch (Significance)
+	{
+	case EEliteSignificance::Medium: return FMath::Max(1.0f, GEliteMediumLOSCacheScale);
+	case EEliteSignificance::Low: return FMath::Max(1.0f, GEliteLowLOSCacheScale);
+	default: return 1.0f;
+	}
+}
+
+TStatId UEliteSignificanceManager::GetStepStatId(EEliteSignificance Significance)
+{
+	switch (Significance)
+	{
+	case EEliteSignificance::Medium: return GET_STATID(STAT_SoulstrikeAI_StepMedium);
+	case EEliteSignificance::Low: return GET_STATID(STAT_SoulstrikeAI_StepLow);
+	default: return GET_STATID(STAT_SoulstrikeAI_StepHigh);
+	}
+}
+
+int32 UEliteSignificanceManager::ComputeDistanceBand(float Distance, int32 PreviousBand)
+{
+	const float Edges[2] = { GEliteSignificanceNearDistance, GEliteSignificanceMidDistance };
+
+	// Each edge is pushed away from the side the elite is currently on
+	int32 Band = 0;
+	for (int32 i = 0; i < 2; ++i)
+	{
+		const float Edge = PreviousBand <= i ? Edges[i] + GEliteSignificanceHysteresis : Edges[i] - GEliteSignificanceHysteresis;
+		if (Distance > Edge)
+		{
+			Band = i + 1;
+		}
+	}
+	return Band;
+}
+
+bool UEliteSignificanceManager::ComputeInView(const FVector& ViewLocation, const FVector& ViewDirection, float HalfFOVRadians,
+	const FVector& EliteLocation, bool bWasInView)
+{
+	const FVector ToElite = (EliteLocation - ViewLocation).GetSafeNormal();
+	if (ToElite.IsNearlyZero())
+		return true;
+
+	const float Margin = bWasInView ? FMath::DegreesToRadians(GEliteSignificanceViewMargin) : 0.0f;
+	const float HalfAngle = FMath::Min(HalfFOVRadians + Margin, PI);
+	return FVector::DotProduct(ViewDirection, ToElite) >= FMath::Cos(HalfAngle);
+}
+
+void UEliteSignificanceManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_Significance);
+	SOULSTRIKE_AI_STAGE(Significance);
+
+	UWorld* World = GetWorld();
+	APlayerController* PlayerController = World->GetFirstPlayerController();
+	const APawn* PlayerPawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+
+	TierCounts[0] = TierCounts[1] = TierCounts[2] = 0;
+
+	// Without a player everything stays at full rate (nothing to be far away from)
+	FVector ViewLocation = FVector::ZeroVector;
+	FRotator ViewRotation = FRotator::ZeroRotator;
+	float HalfFOVRadians = PI;
+	if (PlayerPawn)
+	{
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		const float FOV = PlayerController->PlayerCameraManager ? PlayerController->PlayerCameraManager->GetFOVAngle() : 90.0f;
+		HalfFOVRadians = FMath::DegreesToRadians(FOV * 0.5f);
+	}
+	const FVector ViewDirection = ViewRotation.Vector();
+
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		FSignificanceEntry& Entry = It.Value();
+		const APawn* Elite = Entry.Elite.Get();
+		if (!Elite)
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (PlayerPawn)
+		{
+			const FVector EliteLocation = Elite->GetActorLocation();
+			const float Distance = FVector::Dist(EliteLocation, PlayerPawn->GetActorLocation());
+
+			Entry.DistanceBand = ComputeDistanceBand(Distance, Entry.DistanceBand);
+			Entry.bInView = ComputeInView(ViewLocation, ViewDirection, HalfFOVRadians, EliteLocation, Entry.bInView);
+
+			// Off-screen elites drop one tier
+			const int32 Tier = FMath::Min(Entry.DistanceBand + (Entry.bInView ? 0 : 1), 2);
+			Entry.Significance = (EEliteSignificance)Tier;
+		}
+		else
+		{
+			Entry.Significance = EEliteSignificance::High;
+		}
+
+		++TierCounts[(int32)Entry.Significance];
+	}
+
+	SET_DWORD_STAT(STAT_SoulstrikeAI_ElitesHigh, TierCounts[0]);
+	SET_DWORD_STAT(STAT_SoulstrikeAI_ElitesMedium, TierCounts[1]);
+	SET_DWORD_STAT(STAT_SoulstrikeAI_ElitesLow, TierCounts[2]);
+}
+
+void UEliteSignificanceManager::DumpTiers(UWorld* World)
+{
+	UEliteSignificanceManager* Manager = Get(World);
+	if (!Manager)
+		return;
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteSignificanceManager: %d elites - High %d, Medium %d, Low %d"),
+		Manager->Entries.Num(), Manager->TierCounts[0], Manager->TierCounts[1], Manager->TierCounts[2]);
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "SoulstrikeTickableWorldSubsystem.h"
+#include "EliteSignificanceManager.generated.h"
+
+/**
+ * How much an elite matters to the player right now - decides how much AI work it gets
+ */
+UENUM(BlueprintType)
+enum class EEliteSignificance : uint8
+{
+	High UMETA(DisplayName = "High"),		// Near and on screen: full rate, learning, debug draw
+	Medium UMETA(DisplayName = "Medium"),	// Mid range: reduced step rate, relaxed LOS cache, no debug draw
+	Low UMETA(DisplayName = "Low")			// Far away or off screen: inference only at a very low rate
+};
+
+/**
+ * Elite Significance Manager - assigns every possessed elite a significance tier each frame.
+ * Tiers come from the distance band to the player pawn, dropped one tier when the elite is
+ * outside the player's view cone. Band edges and the view cone use hysteresis so elites near a
+ * boundary do not flicker between tiers.
+ */
+UCLASS()
+class SOULSTRIKE_API UEliteSignificanceManager : public USoulstrikeTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the manager for a world (null for non-game worlds) */
+	static UEliteSignificanceManager* Get(const UWorld* World);
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Start tracking an elite (starts out High until the next update) */
+	void Register(const APawn* Elite);
+
+	/** Stop tracking an elite */
+	void Unregister(const APawn* Elite);
+
+	/** Current tier of an elite (High if it is not tracked) */
+	EEliteSignificance GetSignificance(const APawn* Elite) const;
+
+	// ========== TIER BEHAVIOR ==========
+
+	/** Minimum seconds between RL steps for a tier (0 = every tick) */
+	static float GetStepInterval(EEliteSignificance Significance);
+
+	/** Multiplier on the LOS cache move threshold and max age for a tier */
+	static float GetLineOfSightCacheScale(EEliteSignificance Significance);
+
+	/** Whether elites in a tier still update their weights (Low runs inference only) */
+	static bool AllowsLearning(EEliteSignificance Significance) { return Significance != EEliteSignificance::Low; }
+
+	/** Whether elites in a tier draw debug info */
+	static bool AllowsDebugDraw(EEliteSignificance Significance) { return Significance == EEliteSignificance::High; }
+
+	/** Cycle stat covering the RL step of an elite in a tier */
+	static TStatId GetStepStatId(EEliteSignificance Significance);
+
+	/** Print tier populations to the log (Soulstrike.AI.Significance) */
+	static void DumpTiers(UWorld* World);
+
+private:
+	struct FSignificanceEntry
+	{
+		TWeakObjectPtr<const APawn> Elite;
+		EEliteSignificance Significance = EEliteSignificance::High;
+
+		/** 0 = near, 1 = mid, 2 = far */
+		int32 DistanceBand = 0;
+		bool bInView = true;
+	};
+
+	static int32 ComputeDistanceBand(float Distance, int32 PreviousBand);
+	static bool ComputeInView(const FVector& ViewLocation, const FVector& ViewDirection, float HalfFOVRadians,
+		const FVector& EliteLocation, bool bWasInView);
+
+	TMap<FObjectKey, FSignificanceEntry> Entries;
+
+	/** Number of tracked elites per tier after the last update */
+	int32 TierCounts[3] = { 0, 0, 0 };
+};
@@ -0,0 +1,255 @@
+#include "EliteStatusEffectManager.h"
+#include "EliteCombatEventBus.h"
+#include "RLComponent.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "HAL/IConsoleManager.h"
+
+/** Seconds per wheel tick - effect timing is quantized to this */
+static const float StatusEffectTickSeconds = 0.05f;
+
+static FAutoConsoleCommandWithWorld GEliteStatusEffectsCommand(
+	TEXT("Soulstrike.AI.StatusEffects"),
+	TEXT("Print the number of running status effects and damage ticks fired."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&UEliteStatusEffectManager::DumpEffects));
+
+UEliteStatusEffectManager* UEliteStatusEffectManager::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UEliteStatusEffectManager>() : nullptr;
+}
+
+void UEliteStatusEffectManager::Deinitialize()
+{
+	Effects.Empty();
+	ActiveCounts.Empty();
+	for (TArray<int32>& Slot : SlotsLevel0)
+	{
+		Slot.Empty();
+	}
+	for (int32 Level = 0; Level < NumUpperLevels; ++Level)
+	{
+		for (TArray<int32>& Slot : SlotsUpperLevels[Level])
+		{
+			Slot.Empty();
+		}
+	}
+
+	Super::Deinitialize();
+}
+
+TStatId UEliteStatusEffectManager::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEliteStatusEffectManager, STATGROUP_Tickables);
+}
+
+void UEliteStatusEffectManager::ApplyDamageOverTime(URLComponent* Source, AActor* Instigator, ACharacter* Target,
+	EEliteStatusEffect Type, float DamagePerTick, float TickInterval, float Duration)
+{
+	if (!Source || !Target || TickInterval <= 0.0f || Duration <= 0.0f)
+		return;
+
+	FEffect Effect;
+	Effect.Source = Source;
+	Effect.SourceKey = FObjectKey(Source);
+	Effect.Instigator = Instigator;
+	Effect.Target = Target;
+	Effect.Type = Type;
+	Effect.DamagePerTick = DamagePerTick;
+	Effect.IntervalTicks = FMath::Max(1, FMath::RoundToInt(TickInterval / StatusEffectTickSeconds));
+	Effect.RemainingTicks = FMath::Max(1, FMath::RoundToInt(Duration / TickInterval));
+	Effect.DueTick = CurrentTick + Effect.IntervalTicks;
+
+	Schedule(Effects.Add(Effect));
+
+	++ActiveCounts.FindOrAdd(Effect.SourceKey).Counts[(int32)Type];
+}
+
+int32 UEliteStatusEffectManager::GetActiveCount(const URLComponent* Source, EEliteStatusEffect Type) const
+{
+	const FEffectCounts* Counts = ActiveCounts.Find(FObjectKey(Source));
+	return Counts ? Counts->Counts[(int32)Type] : 0;
+}
+
+void UEliteStatusEffectManager::Schedule(int32 EffectIndex)
+{
+	const uint64 DueTick = FMath::Max(Effects[EffectIndex].DueTick, CurrentTick);
+	const uint64 Delta = DueTick - CurrentTick;
+
+	if (Delta < SlotsL0)
+	{
+		SlotsLevel0[DueTick & (SlotsL0 - 1)].Add(EffectIndex);
+		return;
+	}
+
+	// Find the first upper level whose span covers the delay (the last level takes everything beyond)
+	int32 Shift = SlotBitsL0;
+	for (int32 Level = 0; Level < NumUpperLevels; ++Level, Shift += SlotBitsUpper)
+	{
+		const bool bLastLevel = Level == NumUpperLevels - 1;
+		if (Delta < ((uint64)1 << (Shift + SlotBitsUpper)) || bLastLevel)
+		{
+			const uint64 SlotTick = bLastLevel ? FMath::Min(DueTick, CurrentTick + ((uint64)1 << (Shift + SlotBitsUpper)) - 1) : DueTick;
+			SlotsUpperLevels[Level][(SlotTick >> Shift) & (SlotsUpper - 1)].Add(EffectIndex);
+			return;
+		}
+	}
+}
+
+void UEliteStatusEffectManager::Cascade(int32 Level, int32 Slot)
+{
+	// Re-scheduling from CurrentTick drops each effect one or more levels
+	CascadeScratch.Reset();
+	Swap(CascadeScratch, SlotsUpperLevels[Level][Slot]);
+	for (int32 EffectIndex : CascadeScratch)
+	{
+		Schedule(EffectIndex);
+	}
+}
+
+void UEliteStatusEffectManager::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_StatusEffects);
+	SOULSTRIKE_AI_STAGE(StatusEffects);
+
+	TickRemainder += DeltaTime;
+	const int32 TicksToRun = FMath::FloorToInt(TickRemainder / StatusEffectTickSeconds);
+	TickRemainder -= TicksToRun * StatusEffectTickSeconds;
+
+	// Advance the wheel, collecting every effect that comes due on the way
+	DueEffects.Reset();
+	for (int32 Step = 0; Step < TicksToRun; ++Step)
+	{
+		++CurrentTick;
+
+		// Entering a new turn of a level pulls the matching slot of the level above down
+		if ((CurrentTick & (SlotsL0 - 1)) == 0)
+		{
+			int32 Shift = SlotBitsL0;
+			int32 Level = 0;
+			while (Level < NumUpperLevels - 1 && ((CurrentTick >> (Shift + SlotBitsUpper)) << (Shift + SlotBitsUpper)) == CurrentTick)
+			{
+				++Level;
+				Shift += SlotBitsUpper;
+			}
+			for (; Level >= 0; --Level, Shift -= SlotBitsUpper)
+			{
+				Cascade(Level, (CurrentTick >> Shift) & (SlotsUpper - 1));
+			}
+		}
+
+		TArray<int32>& Slot = SlotsLevel0[CurrentTick & (SlotsL0 - 1)];
+		DueEffects.Append(Slot);
+		Slot.Reset();
+	}
+
+	for (int32 EffectIndex : DueEffects)
+	{
+		FireEffect(EffectIndex);
+	}
+	FlushPendingDamage();
+
+	SET_DWORD_STAT(STAT_SoulstrikeAI_ActiveStatusEffects, Effects.Num());
+}
+
+void UEliteStatusEffectManager::FireEffect(int32 EffectIndex)
+{
+	FEffect& Effect = Effects[EffectIndex];
+
+	URLComponent* Source = Effect.Source.Get();
+	if (!Source || !Effect.Target.IsValid())
+	{
+		RetireEffect(EffectIndex);
+		return;
+	}
+
+	FPendingDamage* Pending = PendingDamage.FindByPredicate([&Effect](const FPendingDamage& Entry)
+	{
+		return Entry.Source == Effect.Source && Entry.Target == Effect.Target;
+	});
+	if (!Pending)
+	{
+		Pending = &PendingDamage.AddDefaulted_GetRef();
+		Pending->Source = Effect.Source;
+		Pending->Instigator = Effect.Instigator;
+		Pending->Target = Effect.Target;
+	}
+
+	// A long frame can span several ticks of the same effect
+	do
+	{
+		Pending->Damage += Effect.DamagePerTick;
+		++TotalTicksFired;
+
+		if (--Effect.RemainingTicks <= 0)
+		{
+			RetireEffect(EffectIndex);
+			return;
+		}
+
+		Effect.DueTick += Effect.IntervalTicks;
+	}
+	while (Effect.DueTick <= CurrentTick);
+
+	Schedule(EffectIndex);
+}
+
+void UEliteStatusEffectManager::RetireEffect(int32 EffectIndex)
+{
+	const FEffect& Effect = Effects[EffectIndex];
+
+	if (FEffectCounts* Counts = ActiveCounts.Find(Effect.SourceKey))
+	{
+		int32& Count = Counts->Counts[(int32)Effect.Type];
+		Count = FMath::Max(0, Count - 1);
+
+		bool bAnyActive = false;
+		for (int32 TypeCount : Counts->Counts)
+		{
+			bAnyActive |= TypeCount > 0;
+		}
+		if (!bAnyActive)
+		{
+			ActiveCounts.Remove(Effect.SourceKey);
+		}
+	}
+
+	Effects.RemoveAt(EffectIndex);
+}
+
+void UEliteStatusEffectManager::FlushPendingDamage()
+{
+	if (PendingDamage.Num() == 0)
+		return;
+
+	UEliteCombatEventBus* CombatEvents = UEliteCombatEventBus::Get(GetWorld());
+
+	for (const FPendingDamage& Pending : PendingDamage)
+	{
+		if (URLComponent* Source = Pending.Source.Get())
+		{
+			Source->RecordDamageDealt(Pending.Damage);
+		}
+
+		if (CombatEvents && Pending.Target.IsValid())
+		{
+			CombatEvents->PushDamage(Pending.Target.Get(), Pending.Damage, Pending.Instigator.Get());
+			++TotalReports;
+		}
+	}
+
+	PendingDamage.Reset();
+}
+
+void UEliteStatusEffectManager::DumpEffects(UWorld* World)
+{
+	UEliteStatusEffectManager* Manager = Get(World);
+	if (!Manager)
+		return;
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteStatusEffectManager: %d effects from %d sources, %lld damage ticks fired in %lld reports"),
+		Manager->Effects.Num(), Manager->ActiveCounts.Num(), Manager->TotalTicksFired, Manager->TotalReports);
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/ObjectKey.h"
+#include "SoulstrikeTickableWorldSubsystem.h"
+#include "EliteStatusEffectManager.generated.h"
+
+class ACharacter;
+class URLComponent;
+
+/**
+ * Kinds of status effect elites can apply
+ */
+UENUM(BlueprintType)
+enum class EEliteStatusEffect : uint8
+{
+	Poison UMETA(DisplayName = "Poison"),	// Assassin damage over time
+	Count UMETA(Hidden)
+};
+
+/**
+ * Elite Status Effect Manager - runs every damage-over-time effect in the world.
+ * Effects wait in a hierarchical timing wheel (SlotsL0 one-tick slots, then two coarser levels
+ * that cascade down), so per frame only the ticks actually due are touched however many effects
+ * are running. Due ticks fire as one batch and damage goes to the combat event bus once per
+ * source per frame.
+ * Active effect counts per source are kept up to date for O(1) queries.
+ */
+UCLASS()
+class SOULSTRIKE_API UEliteStatusEffectManager : public USoulstrikeTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the manager for a world (null for non-game worlds) */
+	static UEliteStatusEffectManager* Get(const UWorld* World);
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Start a damage-over-time effect. Damage is dealt every TickInterval seconds, the last tick
+	 * landing when Duration runs out. Damage is credited to Source and reported with Instigator.
+	 */
+	void ApplyDamageOverTime(URLComponent* Source, AActor* Instigator, ACharacter* Target, EEliteStatusEffect Type,
+		float DamagePerTick, float TickInterval, float Duration);
+
+	/** Effects of a type a source has running */
+	int32 GetActiveCount(const URLComponent* Source, EEliteStatusEffect Type) const;
+
+	/** Print effect counters to the log (Soulstrike.AI.StatusEffects) */
+	static void DumpEffects(UWorld* World);
+
+private:
+	struct FEffect
+	{
+		TWeakObjectPtr<URLComponent> Source;
+
+		/** Source's key in ActiveCounts (still valid once the source is gone) */
+		FObjectKey SourceKey;
+
+		TWeakObjectPtr<AActor> Instigator;
+		TWeakObjectPtr<ACharacter> Target;
+		EEliteStatusEffect Type = EEliteStatusEffect::Poison;
+		float DamagePerTick = 0.0f;
+
+		/** Wheel ticks between damage ticks */
+		uint32 IntervalTicks = 1;
+
+		/** Damage ticks left */
+		int32 RemainingTicks = 0;
+
+		/** Wheel tick the next damage tick is due on */
+		uint64 DueTick = 0;
+	};
+
+	struct FEffectCounts
+	{
+		int32 Counts[(int32)EEliteStatusEffect::Count] = {};
+	};
+
+	/** Damage due this frame from one source against one target */
+	struct FPendingDamage
+	{
+		TWeakObjectPtr<URLComponent> Source;
+		TWeakObjectPtr<AActor> Instigator;
+		TWeakObjectPtr<ACharacter> Target;
+		float Damage = 0.0f;
+	};
+
+	static constexpr int32 SlotBitsL0 = 8;
+	static constexpr int32 SlotBitsUpper = 6;
+	static constexpr int32 SlotsL0 = 1 << SlotBitsL0;
+	static constexpr int32 SlotsUpper = 1 << SlotBitsUpper;
+	static constexpr int32 NumUpperLevels = 2;
+
+	/** Put an effect in the slot for its due tick */
+	void Schedule(int32 EffectIndex);
+
+	/** Move the effects of an upper level slot down now that its span has started */
+	void Cascade(int32 Level, int32 Slot);
+
+	/** Fire a due effect (catching up on every tick it missed): accumulate its damage and reschedule or retire it */
+	void FireEffect(int32 EffectIndex);
+
+	/** Report the frame's accumulated damage, once per source and target */
+	void FlushPendingDamage();
+
+	void RetireEffect(int32 EffectIndex);
+
+	TSparseArray<FEffect> Effects;
+
+	/** Level 0: one slot per wheel tick */
+	TArray<int32> SlotsLevel0[SlotsL0];
+
+	/** Upper levels: each slot spans a whole turn of the level below */
+	TArray<int32> SlotsUpperLevels[NumUpperLevels][SlotsUpper];
+
+	/** Last wheel tick processed */
+	uint64 CurrentTick = 0;
+
+	/** Time not yet converted to wheel ticks */
+	float TickRemainder = 0.0f;
+
+	/** Reused every frame */
+	TArray<int32> DueEffects;
+	TArray<int32> CascadeScratch;
+	TArray<FPendingDamage> PendingDamage;
+
+	/** Active effects per source, one count per effect type */
+	TMap<FObjectKey, FEffectCounts> ActiveCounts;
+
+	int64 TotalTicksFired = 0;
+	int64 TotalReports = 0;
+};
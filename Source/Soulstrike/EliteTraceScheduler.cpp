@@ -0,0 +1,226 @@
+#include "EliteTraceScheduler.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeStats.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+
+static int32 GEliteTraceBudget = 8;
+static FAutoConsoleVariableRef CVarEliteTraceBudget(
+	TEXT("Soulstrike.AI.TraceBudget"),
+	GEliteTraceBudget,
+	TEXT("Maximum elite line-of-sight traces issued per frame."));
+
+static float GEliteLOSMoveThreshold = 75.0f;
+static FAutoConsoleVariableRef CVarEliteLOSMoveThreshold(
+	TEXT("Soulstrike.AI.LOSCacheMoveThreshold"),
+	GEliteLOSMoveThreshold,
+	TEXT("Distance either endpoint may move before a cached line-of-sight result is refreshed."));
+
+static float GEliteLOSMaxAge = 0.5f;
+static FAutoConsoleVariableRef CVarEliteLOSMaxAge(
+	TEXT("Soulstrike.AI.LOSCacheMaxAge"),
+	GEliteLOSMaxAge,
+	TEXT("Seconds after which a cached line-of-sight result is refreshed even if nothing moved."));
+
+static float GEliteLOSFarDistance = 5000.0f;
+static FAutoConsoleVariableRef CVarEliteLOSFarDistance(
+	TEXT("Soulstrike.AI.LOSPriorityFarDistance"),
+	GEliteLOSFarDistance,
+	TEXT("Elites at or beyond this distance from the player get no proximity priority for refreshes."));
+
+static FAutoConsoleCommandWithWorld GEliteTraceStatsCommand(
+	TEXT("Soulstrike.AI.TraceStats"),
+	TEXT("Print elite visibility trace counters (issued vs. served from cache)."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&UEliteTraceScheduler::DumpStats));
+
+UEliteTraceScheduler* UEliteTraceScheduler::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UEliteTraceScheduler>() : nullptr;
+}
+
+void UEliteTraceScheduler::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	TraceDelegate.BindUObject(this, &UEliteTraceScheduler::OnTraceCompleted);
+}
+
+void UEliteTraceScheduler::Deinitialize()
+{
+	TraceDelegate.Unbind();
+	Entries.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId UEliteTraceScheduler::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEliteTraceScheduler, STATGROUP_Tickables);
+}
+
+bool UEliteTraceScheduler::QueryLineOfSight(const AActor* Requester, const AActor* Target, const FVector& TargetLocation, float CacheScale)
+{
+	if (!Requester || !Target)
+		return false;
+
+	const uint32 Key = Requester->GetUniqueID();
+	FLineOfSightEntry& Entry = Entries.FindOrAdd(Key);
+
+	// UniqueIDs are recycled - start over if the slot belonged to someone else
+	if (Entry.Requester.Get() != Requester || Entry.Target.Get() != Target)
+	{
+		Entry = FLineOfSightEntry();
+		Entry.Requester = Requester;
+		Entry.Target = Target;
+	}
+
+	Entry.RequestedFrom = Requester->GetActorLocation();
+	Entry.RequestedTo = TargetLocation;
+	Entry.CacheScale = FMath::Max(1.0f, CacheScale);
+
+	if (IsEntryValid(Entry, GetWorld()->GetTimeSeconds()))
+	{
+		++FrameStats.CacheHits;
+		return Entry.bVisible;
+	}
+
+	Entry.bWantsRefresh = true;
+	++FrameStats.StaleServed;
+	return Entry.bVisible;
+}
+
+void UEliteTraceScheduler::RemoveRequester(const AActor* Requester)
+{
+	if (Requester)
+	{
+		Entries.Remove(Requester->GetUniqueID());
+	}
+}
+
+bool UEliteTraceScheduler::IsEntryValid(const FLineOfSightEntry& Entry, double Now) const
+{
+	if (!Entry.bHasResult)
+		return false;
+
+	if (Now - Entry.LastTraceTime > GEliteLOSMaxAge * Entry.CacheScale)
+		return false;
+
+	const float ThresholdSq = FMath::Square(GEliteLOSMoveThreshold * Entry.CacheScale);
+	return FVector::DistSquared(Entry.TracedFrom, Entry.RequestedFrom) <= ThresholdSq
+		&& FVector::DistSquared(Entry.TracedTo, Entry.RequestedTo) <= ThresholdSq;
+}
+
+float UEliteTraceScheduler::GetRefreshPriority(const FLineOfSightEntry& Entry, double Now) const
+{
+	// Never-traced entries go first; otherwise staleness (in cache lifetimes) plus proximity [0,1]
+	const float Staleness = Entry.bHasResult
+		? (float)(Now - Entry.LastTraceTime) / FMath::Max(GEliteLOSMaxAge * Entry.CacheScale, KINDA_SMALL_NUMBER)
+		: 100.0f;
+
+	const float Distance = FVector::Dist(Entry.RequestedFrom, Entry.RequestedTo);
+	const float Proximity = 1.0f - FMath::Clamp(Distance / FMath::Max(GEliteLOSFarDistance, 1.0f), 0.0f, 1.0f);
+
+	return Staleness + Proximity;
+}
+
+void UEliteTraceScheduler::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SOULSTRIKE_AI_STAGE(TraceScheduler);
+
+	UWorld* World = GetWorld();
+	const double Now = World->GetTimeSeconds();
+
+	// Collect entries that want a fresh trace
+	TArray<TPair<float, uint32>> Candidates;
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		FLineOfSightEntry& Entry = It.Value();
+		if (!Entry.Requester.IsValid() || !Entry.Target.IsValid())
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (Entry.bWantsRefresh && !Entry.bTracePending)
+		{
+			Candidates.Emplace(GetRefreshPriority(Entry, Now), It.Key());
+		}
+	}
+
+	Candidates.Sort([](const TPair<float, uint32>& A, const TPair<float, uint32>& B) {
+		return A.Key > B.Key;
+	});
+
+	const int32 NumToIssue = FMath::Min(FMath::Max(0, GEliteTraceBudget), Candidates.Num());
+	for (int32 i = 0; i < NumToIssue; ++i)
+	{
+		const uint32 Key = Candidates[i].Value;
+		IssueTrace(Key, Entries[Key]);
+	}
+	FrameStats.Deferred += Candidates.Num() - NumToIssue;
+
+	// Publish this frame's counters
+	PeakDemandPerFrame = FMath::Max(PeakDemandPerFrame, Candidates.Num() + FrameStats.SwarmTraces);
+	++NumFrames;
+
+	SET_DWORD_STAT(STAT_SoulstrikeAI_TracesIssued, FrameStats.TracesIssued);
+	SET_DWORD_STAT(STAT_SoulstrikeAI_SwarmTraces, FrameStats.SwarmTraces);
+	CSV_CUSTOM_STAT(SoulstrikeAI, TracesIssued, FrameStats.TracesIssued, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(SoulstrikeAI, SwarmTraces, FrameStats.SwarmTraces, ECsvCustomStatOp::Set);
+
+	LastFrameStats = FrameStats;
+	TotalStats.Accumulate(FrameStats);
+	FrameStats = FEliteTraceStats();
+}
+
+void UEliteTraceScheduler::IssueTrace(uint32 Key, FLineOfSightEntry& Entry)
+{
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(EliteLineOfSight), false, Entry.Requester.Get());
+
+	GetWorld()->AsyncLineTraceByChannel(EAsyncTraceType::Single, Entry.RequestedFrom, Entry.RequestedTo,
+		ECC_Visibility, Params, FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, Key);
+
+	Entry.bTracePending = true;
+	Entry.bWantsRefresh = false;
+	++FrameStats.TracesIssued;
+}
+
+void UEliteTraceScheduler::OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	// Entry may have been removed while the trace was in flight
+	FLineOfSightEntry* Entry = Entries.Find(Datum.UserData);
+	if (!Entry || !Entry->bTracePending)
+		return;
+
+	const FHitResult* Hit = Datum.OutHits.Num() > 0 ? &Datum.OutHits[0] : nullptr;
+	const bool bBlocked = Hit && Hit->bBlockingHit;
+
+	Entry->bVisible = !bBlocked || Hit->GetActor() == Entry->Target.Get();
+	Entry->bHasResult = true;
+	Entry->bTracePending = false;
+	Entry->TracedFrom = Datum.Start;
+	Entry->TracedTo = Datum.End;
+	Entry->LastTraceTime = GetWorld()->GetTimeSeconds();
+}
+
+void UEliteTraceScheduler::DumpStats(UWorld* World)
+{
+	UEliteTraceScheduler* Scheduler = Get(World);
+	if (!Scheduler)
+		return;
+
+	const FEliteTraceStats& Last = Scheduler->LastFrameStats;
+	const FEliteTraceStats& Total = Scheduler->TotalStats;
+	const float Frames = FMath::Max(1, Scheduler->NumFrames);
+	const int32 Answered = Total.CacheHits + Total.StaleServed;
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteTraceScheduler: last frame - issued %d, cache hits %d, stale served %d, deferred %d, swarm %d"),
+		Last.TracesIssued, Last.CacheHits, Last.StaleServed, Last.Deferred, Last.SwarmTraces);
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteTraceScheduler: %d frames - %.2f issued/frame, %.2f swarm/frame, %.1f%% of queries served from cache, peak demand %d/frame (budget %d), %d tracked elites"),
+		Scheduler->NumFrames, Total.TracesIssued / Frames, Total.SwarmTraces / Frames,
+		Answered > 0 ? 100.0f * Total.CacheHits / Answered : 0.0f,
+		Scheduler->PeakDemandPerFrame, GEliteTraceBudget, Scheduler->Entries.Num());
+}
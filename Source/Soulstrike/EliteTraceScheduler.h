@@ -0,0 +1,125 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "WorldCollision.h"
+#include "SoulstrikeTickableWorldSubsystem.h"
+#include "EliteTraceScheduler.generated.h"
+
+/**
+ * Trace counters used to size the per-frame visibility budget
+ */
+struct FEliteTraceStats
+{
+	/** Line-of-sight traces issued by the scheduler */
+	int32 TracesIssued = 0;
+
+	/** Queries answered from a still-valid cache entry */
+	int32 CacheHits = 0;
+
+	/** Queries answered with the last known result while a refresh waits for budget */
+	int32 StaleServed = 0;
+
+	/** Refreshes pushed to a later frame because the budget ran out */
+	int32 Deferred = 0;
+
+	/** Obstacle (jump) traces issued directly by swarm enemies - not budgeted, only counted */
+	int32 SwarmTraces = 0;
+
+	void Accumulate(const FEliteTraceStats& Other)
+	{
+		TracesIssued += Other.TracesIssued;
+		CacheHits += Other.CacheHits;
+		StaleServed += Other.StaleServed;
+		Deferred += Other.Deferred;
+		SwarmTraces += Other.SwarmTraces;
+	}
+};
+
+/**
+ * Elite Trace Scheduler - caps elite visibility traces per frame across all elites.
+ * Elites query line of sight every RL step; results are cached until either endpoint moves
+ * past a threshold or the entry gets too old. Stale entries are refreshed with async traces,
+ * closest-to-player and most-stale first, up to Soulstrike.AI.TraceBudget per frame.
+ */
+UCLASS()
+class SOULSTRIKE_API UEliteTraceScheduler : public USoulstrikeTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the scheduler for a world (null for non-game worlds) */
+	static UEliteTraceScheduler* Get(const UWorld* World);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Line of sight from Requester to Target. Returns the cached result (or the last known
+	 * one while a refresh is queued). Never traces synchronously. CacheScale > 1 lets
+	 * less significant elites keep results longer and move further before refreshing.
+	 */
+	bool QueryLineOfSight(const AActor* Requester, const AActor* Target, const FVector& TargetLocation, float CacheScale = 1.0f);
+
+	/** Drop the cache entry of a requester (called when an elite leaves play) */
+	void RemoveRequester(const AActor* Requester);
+
+	/** Count an unscheduled obstacle trace from a swarm enemy */
+	void NoteSwarmTrace() { ++FrameStats.SwarmTraces; }
+
+	/** Counters of the last completed frame */
+	const FEliteTraceStats& GetLastFrameStats() const { return LastFrameStats; }
+
+	/** Counters since the world started */
+	const FEliteTraceStats& GetTotalStats() const { return TotalStats; }
+
+	/** Print counters to the log (Soulstrike.AI.TraceStats) */
+	static void DumpStats(UWorld* World);
+
+private:
+	/** Cached visibility of one requester towards its target */
+	struct FLineOfSightEntry
+	{
+		TWeakObjectPtr<const AActor> Requester;
+		TWeakObjectPtr<const AActor> Target;
+
+		/** Endpoints of the last completed trace */
+		FVector TracedFrom = FVector::ZeroVector;
+		FVector TracedTo = FVector::ZeroVector;
+
+		/** Endpoints of the latest query */
+		FVector RequestedFrom = FVector::ZeroVector;
+		FVector RequestedTo = FVector::ZeroVector;
+
+		double LastTraceTime = 0.0;
+
+		/** Multiplier on move threshold and max age from the latest query */
+		float CacheScale = 1.0f;
+
+		/** Matches the FRLState default until the first trace lands */
+		bool bVisible = true;
+		bool bHasResult = false;
+		bool bWantsRefresh = true;
+		bool bTracePending = false;
+	};
+
+	bool IsEntryValid(const FLineOfSightEntry& Entry, double Now) const;
+	float GetRefreshPriority(const FLineOfSightEntry& Entry, double Now) const;
+	void IssueTrace(uint32 Key, FLineOfSightEntry& Entry);
+	void OnTraceCompleted(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	/** Entries keyed by the requester's UniqueID (also passed as trace UserData) */
+	TMap<uint32, FLineOfSightEntry> Entries;
+
+	FTraceDelegate TraceDelegate;
+
+	FEliteTraceStats FrameStats;
+	FEliteTraceStats LastFrameStats;
+	FEliteTraceStats TotalStats;
+
+	/** Highest number of refresh requests plus swarm traces seen in a single frame */
+	int32 PeakDemandPerFrame = 0;
+	int32 NumFrames = 0;
+};
@@ -0,0 +1,396 @@
+#include "EliteTrainCommandlet.h"
+#include "EliteTrajectoryRecorder.h"
+#include "QLearningBrain.h"
+#include "WeightManager.h"
+#include "SoulstrikeLog.h"
+#include "Async/ParallelFor.h"
+#include "Async/TaskGraphInterfaces.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "Misc/Compression.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+namespace EliteTrainer
+{
+	constexpr int32 NumActions = 6;
+	constexpr int32 NumFeatures = 14;
+	constexpr int32 NumWeights = NumActions * NumFeatures;
+
+	/** Records per parallel slice of a mini-batch, below this the split costs more than it saves */
+	constexpr int32 MinSliceRecords = 256;
+
+	/** FQLearningBrain::ExtractFeatures as a dense vector in GetFeatureNames order */
+	void ExtractFeatures(const FRLState& State, float* OutFeatures)
+	{
+		OutFeatures[0] = State.DistanceToPlayer;
+		OutFeatures[1] = State.SelfHealthPercentage;
+		OutFeatures[2] = State.TimeSinceLastAttack;
+		OutFeatures[3] = State.bIsBeyondMaxRange ? 1.0f : 0.0f;
+		OutFeatures[4] = State.bTookDamageRecently ? 1.0f : 0.0f;
+		OutFeatures[5] = State.PlayerHealthPercentage;
+		OutFeatures[6] = State.bHasLineOfSightToPlayer ? 1.0f : 0.0f;
+		OutFeatures[7] = State.HealthOfClosestAlly;
+		OutFeatures[8] = State.DistanceToClosestAlly;
+		OutFeatures[9] = State.HealthOfSecondClosestAlly;
+		OutFeatures[10] = State.DistanceToSecondClosestAlly;
+		OutFeatures[11] = State.HealthOfThirdClosestAlly;
+		OutFeatures[12] = State.DistanceToThirdClosestAlly;
+		OutFeatures[13] = State.NumNearbyAllies;
+	}
+
+	/** The dense layout only works while it matches the brain's own feature map */
+	bool MatchesBrainFeatures()
+	{
+		FRLState Probe;
+		Probe.DistanceToPlayer = 0.01f;
+		Probe.SelfHealthPercentage = 0.02f;
+		Probe.TimeSinceLastAttack = 0.03f;
+		Probe.bIsBeyondMaxRange = true;
+		Probe.bTookDamageRecently = false;
+		Probe.PlayerHealthPercentage = 0.06f;
+		Probe.bHasLineOfSightToPlayer = true;
+		Probe.HealthOfClosestAlly = 0.08f;
+		Probe.DistanceToClosestAlly = 0.09f;
+		Probe.HealthOfSecondClosestAlly = 0.10f;
+		Probe.DistanceToSecondClosestAlly = 0.11f;
+		Probe.HealthOfThirdClosestAlly = 0.12f;
+		Probe.DistanceToThirdClosestAlly = 0.13f;
+		Probe.NumNearbyAllies = 0.14f;
+
+		const TArray<FName> FeatureNames = FQLearningBrain::GetFeatureNames();
+		const TMap<FName, float> BrainFeatures = FQLearningBrain::ExtractFeatures(Probe);
+		if (FeatureNames.Num() != NumFeatures || BrainFeatures.Num() != NumFeatures)
+			return false;
+
+		float DenseFeatures[NumFeatures];
+		ExtractFeatures(Probe, DenseFeatures);
+		for (int32 i = 0; i < NumFeatures; ++i)
+		{
+			const float* BrainValue = BrainFeatures.Find(FeatureNames[i]);
+			if (!BrainValue || *BrainValue != DenseFeatures[i])
+				return false;
+		}
+		return true;
+	}
+
+	float QValue(const float* Weights, int32 Action, const float* Features)
+	{
+		const float* ActionWeights = Weights + Action * NumFeatures;
+		float Value = 0.0f;
+		for (int32 i = 0; i < NumFeatures; ++i)
+		{
+			Value += ActionWeights[i] * Features[i];
+		}
+		return Value;
+	}
+
+	void ToDense(const TMap<EEliteAction, TMap<FName, float>>& Weights, float* OutWeights)
+	{
+		const TArray<FName> FeatureNames = FQLearningBrain::GetFeatureNames();
+		for (int32 Action = 0; Action < NumActions; ++Action)
+		{
+			const TMap<FName, float>* ActionWeights = Weights.Find(static_cast<EEliteAction>(Action));
+			for (int32 Feature = 0; Feature < NumFeatures; ++Feature)
+			{
+				const float* Weight = ActionWeights ? ActionWeights->Find(FeatureNames[Feature]) : nullptr;
+				OutWeights[Action * NumFeatures + Feature] = Weight ? *Weight : 0.0f;
+			}
+		}
+	}
+
+	TMap<EEliteAction, TMap<FName, float>> FromDense(const float* Weights)
+	{
+		const TArray<FName> FeatureNames = FQLearningBrain::GetFeatureNames();
+		TMap<EEliteAction, TMap<FName, float>> Result;
+		for (int32 Action = 0; Action < NumActions; ++Action)
+		{
+			TMap<FName, float>& ActionWeights = Result.Add(static_cast<EEliteAction>(Action));
+			for (int32 Feature = 0; Feature < NumFeatures; ++Feature)
+			{
+				ActionWeights.Add(FeatureNames[Feature], Weights[Action * NumFeatures + Feature]);
+			}
+		}
+		return Result;
+	}
+}
+
+UEliteTrainCommandlet::UEliteTrainCommandlet()
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = false;
+	LogToConsole = true;
+}
+
+int32 UEliteTrainCommandlet::Main(const FString& Params)
+{
+	using namespace EliteTrainer;
+
+	FString TrajectoryDirectory = FPaths::ProjectSavedDir() / TEXT("Trajectories");
+	FString OutFilename = FPaths::ProjectSavedDir() / TEXT("Brains") / TEXT("EliteBrains.sswt");
+	FString InitFilename;
+	int32 Epochs = 4;
+	float Alpha = 0.1f;
+	float Gamma = 0.95f;
+	int32 BatchSize = 4096;
+	int32 Seed = 0;
+
+	FParse::Value(*Params, TEXT("Trajectories="), TrajectoryDirectory);
+	FParse::Value(*Params, TEXT("Out="), OutFilename);
+	FParse::Value(*Params, TEXT("Init="), InitFilename);
+	FParse::Value(*Params, TEXT("Epochs="), Epochs);
+	FParse::Value(*Params, TEXT("Alpha="), Alpha);
+	FParse::Value(*Params, TEXT("Gamma="), Gamma);
+	FParse::Value(*Params, TEXT("BatchSize="), BatchSize);
+	FParse::Value(*Params, TEXT("Seed="), Seed);
+
+	Epochs = FMath::Max(1, Epochs);
+	BatchSize = FMath::Max(1, BatchSize);
+
+	if (!MatchesBrainFeatures())
+	{
+		UE_LOG(LogSoulstrikeAI, Error, TEXT("EliteTrain: Dense features no longer match FQLearningBrain::ExtractFeatures, update EliteTrainer::ExtractFeatures"));
+		return 1;
+	}
+
+	// ========== LOAD ==========
+
+	TArray<FString> Filenames;
+	IFileManager::Get().FindFiles(Filenames, *(TrajectoryDirectory / TEXT("*.sstraj")), true, false);
+	Filenames.Sort();
+
+	TArray<FEliteTrajectoryRecord> Records;
+	int32 NumFilesLoaded = 0;
+	for (const FString& Filename : Filenames)
+	{
+		if (LoadTrajectoryFile(TrajectoryDirectory / Filename, Records))
+		{
+			++NumFilesLoaded;
+		}
+	}
+
+	if (Records.Num() == 0)
+	{
+		UE_LOG(LogSoulstrikeAI, Error, TEXT("EliteTrain: No transitions found in %s (%d file(s))"), *TrajectoryDirectory, Filenames.Num());
+		return 1;
+	}
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteTrain: %d transitions from %d/%d file(s)"), Records.Num(), NumFilesLoaded, Filenames.Num());
+
+	// Indices per elite type; the records themselves stay packed
+	const UEnum* TypeEnum = StaticEnum<EEliteType>();
+	const int32 NumTypes = TypeEnum->NumEnums() - 1;
+	TArray<TArray<int32>> TypeIndices;
+	TypeIndices.SetNum(NumTypes);
+	for (int32 i = 0; i < Records.Num(); ++i)
+	{
+		if (Records[i].EliteType < NumTypes && Records[i].Action < NumActions)
+		{
+			TypeIndices[Records[i].EliteType].Add(i);
+		}
+	}
+
+	// ========== TRAIN ==========
+
+	UWeightManager* WeightManager = NewObject<UWeightManager>();
+	if (!InitFilename.IsEmpty() && !WeightManager->LoadCheckpoint(InitFilename))
+		return 1;
+
+	FRandomStream Random(Seed);
+	const int32 MaxSlices = FTaskGraphInterface::Get().GetNumWorkerThreads() + 1;
+
+	for (int32 TypeIndex = 0; TypeIndex < NumTypes; ++TypeIndex)
+	{
+		TArray<int32>& Indices = TypeIndices[TypeIndex];
+		const EEliteType Type = static_cast<EEliteType>(TypeIndex);
+		if (Indices.Num() == 0)
+			continue;
+
+		float Weights[NumWeights];
+		if (WeightManager->HasWeights(Type))
+		{
+			ToDense(WeightManager->LoadWeights(Type), Weights);
+		}
+		else
+		{
+			// Same starting point as a first-spawn elite in game
+			FQLearningBrain FreshBrain;
+			FreshBrain.InitializeWeights();
+			ToDense(FreshBrain.GetWeights(), Weights);
+		}
+
+		for (int32 Epoch = 0; Epoch < Epochs; ++Epoch)
+		{
+			// Fisher-Yates
+			for (int32 i = Indices.Num() - 1; i > 0; --i)
+			{
+				Indices.Swap(i, Random.RandRange(0, i));
+			}
+
+			double SquaredErrorSum = 0.0;
+
+			for (int32 BatchStart = 0; BatchStart < Indices.Num(); BatchStart += BatchSize)
+			{
+				const int32 BatchCount = FMath::Min(BatchSize, Indices.Num() - BatchStart);
+				const int32 NumSlices = FMath::Clamp(BatchCount / MinSliceRecords, 1, MaxSlices);
+				const int32 SliceSize = FMath::DivideAndRoundUp(BatchCount, NumSlices);
+
+				// Every slice reads the same weights and accumulates into its own gradient
+				TArray<float> SliceGradients;
+				SliceGradients.SetNumZeroed(NumSlices * NumWeights);
+				TArray<double> SliceSquaredErrors;
+				SliceSquaredErrors.SetNumZeroed(NumSlices);
+
+				ParallelFor(NumSlices, [&](int32 Slice)
+				{
+					float* Gradient = SliceGradients.GetData() + Slice * NumWeights;
+					const int32 SliceEnd = FMath::Min(BatchCount, (Slice + 1) * SliceSize);
+
+					FEliteTrajectoryTransition Transition;
+					float Features[NumFeatures];
+					float NextFeatures[NumFeatures];
+
+					for (int32 i = Slice * SliceSize; i < SliceEnd; ++i)
+					{
+						Records[Indices[BatchStart + i]].Unpack(Transition);
+						ExtractFeatures(Transition.State, Features);
+						ExtractFeatures(Transition.NextState, NextFeatures);
+
+						float MaxNextQValue = -FLT_MAX;
+						for (int32 NextAction = 0; NextAction < NumActions; ++NextAction)
+						{
+							MaxNextQValue = FMath::Max(MaxNextQValue, QValue(Weights, NextAction, NextFeatures));
+						}
+
+						// Same TD target as FQLearningBrain::UpdateWeights
+						const float TDError = Transition.Reward + Gamma * MaxNextQValue - QValue(Weights, Transition.Action, Features);
+						SliceSquaredErrors[Slice] += TDError * TDError;
+
+						float* ActionGradient = Gradient + Transition.Action * NumFeatures;
+						for (int32 Feature = 0; Feature < NumFeatures; ++Feature)
+						{
+							ActionGradient[Feature] += TDError * Features[Feature];
+						}
+					}
+				}, NumSlices == 1);
+
+				// Mean of the batch's updates, so Alpha means the same whatever the batch size
+				const float Scale = Alpha / BatchCount;
+				for (int32 Slice = 0; Slice < NumSlices; ++Slice)
+				{
+					const float* Gradient = SliceGradients.GetData() + Slice * NumWeights;
+					for (int32 i = 0; i < NumWeights; ++i)
+					{
+						Weights[i] += Scale * Gradient[i];
+					}
+					SquaredErrorSum += SliceSquaredErrors[Slice];
+				}
+			}
+
+			UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteTrain: %s epoch %d/%d - %d transitions, TD RMSE %.4f"),
+				*TypeEnum->GetNameStringByIndex(TypeIndex), Epoch + 1, Epochs, Indices.Num(), FMath::Sqrt(SquaredErrorSum / Indices.Num()));
+		}
+
+		WeightManager->SaveWeights(Type, FromDense(Weights));
+	}
+
+	// ========== SAVE ==========
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(OutFilename), true);
+	return WeightManager->SaveCheckpoint(OutFilename) ? 0 : 1;
+}
+
+bool UEliteTrainCommandlet::LoadTrajectoryFile(const FString& Filename, TArray<FEliteTrajectoryRecord>& OutRecords)
+{
+	// The region must go before the handle it was mapped from
+	TUniquePtr<IMappedFileHandle> MappedFile(FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename));
+	if (!MappedFile)
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("EliteTrain: Could not map %s"), *Filename);
+		return false;
+	}
+
+	const int64 FileSize = MappedFile->GetFileSize();
+	TUniquePtr<IMappedFileRegion> Region(FileSize > 0 ? MappedFile->MapRegion(0, FileSize) : nullptr);
+	if (!Region)
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("EliteTrain: Could not map %s"), *Filename);
+		return false;
+	}
+
+	const uint8* Data = Region->GetMappedPtr();
+	const int64 Size = Region->GetMappedSize();
+
+	FEliteTrajectoryFileHeader FileHeader;
+	if (Size < static_cast<int64>(sizeof(FileHeader)))
+		return false;
+
+	FMemory::Memcpy(&FileHeader, Data, sizeof(FileHeader));
+	if (FileHeader.Magic != FEliteTrajectoryFileHeader::ExpectedMagic
+		|| FileHeader.Version != FEliteTrajectoryFileHeader::CurrentVersion
+		|| FileHeader.RecordSize != sizeof(FEliteTrajectoryRecord))
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("EliteTrain: %s is not a version %u trajectory file, skipping"), *Filename, FEliteTrajectoryFileHeader::CurrentVersion);
+		return false;
+	}
+
+	// Walk the chunk headers first so every chunk knows where its records land
+	struct FChunk
+	{
+		const uint8* CompressedData;
+		FEliteTrajectoryChunkHeader Header;
+		int32 FirstRecord;
+	};
+
+	TArray<FChunk> Chunks;
+	int64 Offset = sizeof(FileHeader);
+	int32 NumRecords = OutRecords.Num();
+	while (Offset + static_cast<int64>(sizeof(FEliteTrajectoryChunkHeader)) <= Size)
+	{
+		FChunk Chunk;
+		FMemory::Memcpy(&Chunk.Header, Data + Offset, sizeof(Chunk.Header));
+		Offset += sizeof(Chunk.Header);
+
+		// A session that crashed mid-write leaves a partial last chunk
+		if (Offset + Chunk.Header.CompressedSize > Size
+			|| Chunk.Header.UncompressedSize != Chunk.Header.NumRecords * sizeof(FEliteTrajectoryRecord))
+		{
+			UE_LOG(LogSoulstrikeAI, Warning, TEXT("EliteTrain: %s ends in a damaged chunk, using the %d chunk(s) before it"), *Filename, Chunks.Num());
+			break;
+		}
+
+		Chunk.CompressedData = Data + Offset;
+		Chunk.FirstRecord = NumRecords;
+		Chunks.Add(Chunk);
+
+		Offset += Chunk.Header.CompressedSize;
+		NumRecords += Chunk.Header.NumRecords;
+	}
+
+	const int32 FirstNewRecord = OutRecords.Num();
+	OutRecords.SetNumUninitialized(NumRecords);
+
+	TArray<bool> ChunkFailed;
+	ChunkFailed.SetNumZeroed(Chunks.Num());
+
+	ParallelFor(Chunks.Num(), [&](int32 Index)
+	{
+		const FChunk& Chunk = Chunks[Index];
+		ChunkFailed[Index] = !FCompression::UncompressMemory(NAME_Zlib, OutRecords.GetData() + Chunk.FirstRecord, Chunk.Header.UncompressedSize,
+			Chunk.CompressedData, Chunk.Header.CompressedSize);
+	});
+
+	// Drop failed chunks back to front so the earlier record offsets stay valid
+	for (int32 Index = Chunks.Num() - 1; Index >= 0; --Index)
+	{
+		if (ChunkFailed[Index])
+		{
+			UE_LOG(LogSoulstrikeAI, Warning, TEXT("EliteTrain: Chunk %d of %s failed to inflate, skipping it"), Index, *Filename);
+			OutRecords.RemoveAt(Chunks[Index].FirstRecord, Chunks[Index].Header.NumRecords, false);
+		}
+	}
+
+	return OutRecords.Num() > FirstNewRecord;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EliteTrainCommandlet.generated.h"
+
+struct FEliteTrajectoryRecord;
+
+/**
+ * Elite Train Commandlet - offline retraining from recorded trajectories.
+ * Memory-maps every .sstraj file in a directory (see UEliteTrajectoryRecorder), inflates the chunks
+ * in parallel and runs shuffled, multi-epoch TD updates per elite type, spread over all cores in
+ * mini-batches. The result is a UWeightManager checkpoint the game loads with -SoulstrikeBrains=<file>.
+ *
+ *   UE4Editor-Cmd Soulstrike.uproject -run=EliteTrain [-Trajectories=<dir>] [-Out=<file>] [-Init=<file>]
+ *       [-Epochs=4] [-Alpha=0.1] [-Gamma=0.95] [-BatchSize=4096] [-Seed=0]
+ *
+ * Types with no recorded transitions keep their -Init weights (or are left out of the checkpoint).
+ */
+UCLASS()
+class UEliteTrainCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEliteTrainCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	/** Inflate every chunk of one mapped trajectory file and append its records */
+	static bool LoadTrajectoryFile(const FString& Filename, TArray<FEliteTrajectoryRecord>& OutRecords);
+};
@@ -0,0 +1,384 @@
+#include "EliteTrajectoryRecorder.h"
+#include "SoulstrikeLog.h"
+#include "Engine/World.h"
+#include "Containers/CircularQueue.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformFilemanager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Math/Float16.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Compression.h"
+#include "Misc/PackageName.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+
+static int32 GEliteTrajectoryRecord = 0;
+static FAutoConsoleVariableRef CVarEliteTrajectoryRecord(
+	TEXT("Soulstrike.AI.Trajectory.Record"),
+	GEliteTrajectoryRecord,
+	TEXT("1 = stream every learned elite transition to Saved/Trajectories/. Each start opens a new file."));
+
+static int32 GEliteTrajectoryChunkRecords = 4096;
+static FAutoConsoleVariableRef CVarEliteTrajectoryChunkRecords(
+	TEXT("Soulstrike.AI.Trajectory.ChunkRecords"),
+	GEliteTrajectoryChunkRecords,
+	TEXT("Transitions per compressed chunk (read when recording starts)."));
+
+static FAutoConsoleCommandWithWorld GEliteTrajectoryStatsCommand(
+	TEXT("Soulstrike.AI.Trajectory.Stats"),
+	TEXT("Print how many transitions were queued, dropped and written."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&UEliteTrajectoryRecorder::DumpStats));
+
+// ========== RECORD PACKING ==========
+
+namespace EliteTrajectoryPacking
+{
+	uint16 ToHalf(float Value)
+	{
+		return FFloat16(Value).Encoded;
+	}
+
+	float FromHalf(uint16 Encoded)
+	{
+		FFloat16 Half;
+		Half.Encoded = Encoded;
+		return Half.GetFloat();
+	}
+
+	void PackState(const FRLState& State, uint16* OutFloats, uint8& OutFlags, int32 FlagShift)
+	{
+		const float Floats[FEliteTrajectoryRecord::NumStateFloats] =
+		{
+			State.DistanceToPlayer,
+			State.SelfHealthPercentage,
+			State.TimeSinceLastAttack,
+			State.PlayerHealthPercentage,
+			State.HealthOfClosestAlly,
+			State.DistanceToClosestAlly,
+			State.HealthOfSecondClosestAlly,
+			State.DistanceToSecondClosestAlly,
+			State.HealthOfThirdClosestAlly,
+			State.DistanceToThirdClosestAlly,
+			State.NumNearbyAllies
+		};
+
+		for (int32 i = 0; i < FEliteTrajectoryRecord::NumStateFloats; ++i)
+		{
+			OutFloats[i] = ToHalf(Floats[i]);
+		}
+
+		OutFlags |= (State.bIsBeyondMaxRange ? 1 : 0) << FlagShift;
+		OutFlags |= (State.bTookDamageRecently ? 1 : 0) << (FlagShift + 1);
+		OutFlags |= (State.bHasLineOfSightToPlayer ? 1 : 0) << (FlagShift + 2);
+	}
+
+	void UnpackState(const uint16* Floats, uint8 Flags, int32 FlagShift, FRLState& OutState)
+	{
+		OutState.DistanceToPlayer = FromHalf(Floats[0]);
+		OutState.SelfHealthPercentage = FromHalf(Floats[1]);
+		OutState.TimeSinceLastAttack = FromHalf(Floats[2]);
+		OutState.PlayerHealthPercentage = FromHalf(Floats[3]);
+		OutState.HealthOfClosestAlly = FromHalf(Floats[4]);
+		OutState.DistanceToClosestAlly = FromHalf(Floats[5]);
+		OutState.HealthOfSecondClosestAlly = FromHalf(Floats[6]);
+		OutState.DistanceToSecondClosestAlly = FromHalf(Floats[7]);
+		OutState.HealthOfThirdClosestAlly = FromHalf(Floats[8]);
+		OutState.DistanceToThirdClosestAlly = FromHalf(Floats[9]);
+		OutState.NumNearbyAllies = FromHalf(Floats[10]);
+
+		OutState.bIsBeyondMaxRange = ((Flags >> FlagShift) & 1) != 0;
+		OutState.bTookDamageRecently = ((Flags >> (FlagShift + 1)) & 1) != 0;
+		OutState.bHasLineOfSightToPlayer = ((Flags >> (FlagShift + 2)) & 1) != 0;
+	}
+}
+
+FEliteTrajectoryRecord FEliteTrajectoryRecord::Pack(const FEliteTrajectoryTransition& Transition)
+{
+	FEliteTrajectoryRecord Record;
+	FMemory::Memzero(Record);
+
+	Record.Time = Transition.Time;
+	Record.EliteId = Transition.EliteId;
+	Record.Reward = EliteTrajectoryPacking::ToHalf(Transition.Reward);
+	Record.EliteType = Transition.EliteType;
+	Record.Action = Transition.Action;
+
+	EliteTrajectoryPacking::PackState(Transition.State, Record.State, Record.Flags, 0);
+	EliteTrajectoryPacking::PackState(Transition.NextState, Record.NextState, Record.Flags, 3);
+
+	return Record;
+}
+
+void FEliteTrajectoryRecord::Unpack(FEliteTrajectoryTransition& OutTransition) const
+{
+	OutTransition.Time = Time;
+	OutTransition.EliteId = EliteId;
+	OutTransition.Reward = EliteTrajectoryPacking::FromHalf(Reward);
+	OutTransition.EliteType = EliteType;
+	OutTransition.Action = Action;
+
+	EliteTrajectoryPacking::UnpackState(State, Flags, 0, OutTransition.State);
+	EliteTrajectoryPacking::UnpackState(NextState, Flags, 3, OutTransition.NextState);
+}
+
+// ========== WRITER THREAD ==========
+
+/**
+ * Owns the queue, the file and the thread that drains one into the other.
+ * The game thread only ever calls Enqueue and Wake.
+ */
+class FEliteTrajectoryWriter : public FRunnable
+{
+public:
+	static constexpr uint32 QueueCapacity = 1 << 16;
+
+	FEliteTrajectoryWriter(IFileHandle* InFile, int32 InChunkRecords)
+		: Queue(QueueCapacity)
+		, File(InFile)
+		, ChunkRecords(FMath::Max(1, InChunkRecords))
+		, WakeEvent(FPlatformProcess::GetSynchEventFromPool())
+	{
+		const FEliteTrajectoryFileHeader Header;
+		File->Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+
+		Chunk.Reserve(ChunkRecords);
+		Thread = FRunnableThread::Create(this, TEXT("EliteTrajectoryWriter"), 0, TPri_BelowNormal);
+	}
+
+	virtual ~FEliteTrajectoryWriter()
+	{
+		Stop();
+		if (Thread)
+		{
+			Thread->WaitForCompletion();
+			delete Thread;
+		}
+		FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+		delete File;
+	}
+
+	bool Enqueue(const FEliteTrajectoryTransition& Transition)
+	{
+		return Queue.Enqueue(Transition);
+	}
+
+	void Wake()
+	{
+		WakeEvent->Trigger();
+	}
+
+	int64 GetNumWritten() const { return NumWritten; }
+	int64 GetBytesWritten() const { return BytesWritten; }
+
+	// ========== FRunnable ==========
+
+	virtual uint32 Run() override
+	{
+		while (!bStopping)
+		{
+			WakeEvent->Wait(100);
+			Drain();
+		}
+
+		// Whatever was queued before the stop still goes out
+		Drain();
+		WriteChunk();
+		File->Flush();
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopping = true;
+		WakeEvent->Trigger();
+	}
+
+private:
+	void Drain()
+	{
+		FEliteTrajectoryTransition Transition;
+		while (Queue.Dequeue(Transition))
+		{
+			Chunk.Add(FEliteTrajectoryRecord::Pack(Transition));
+			if (Chunk.Num() >= ChunkRecords)
+			{
+				WriteChunk();
+			}
+		}
+	}
+
+	void WriteChunk()
+	{
+		if (Chunk.Num() == 0)
+			return;
+
+		const int32 UncompressedSize = Chunk.Num() * sizeof(FEliteTrajectoryRecord);
+		int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Zlib, UncompressedSize);
+		Compressed.SetNumUninitialized(CompressedSize, false);
+
+		if (!FCompression::CompressMemory(NAME_Zlib, Compressed.GetData(), CompressedSize, Chunk.GetData(), UncompressedSize))
+		{
+			UE_LOG(LogSoulstrikeAI, Warning, TEXT("EliteTrajectoryRecorder: Failed to compress a chunk of %d transitions, dropping it"), Chunk.Num());
+			Chunk.Reset();
+			return;
+		}
+
+		FEliteTrajectoryChunkHeader Header;
+		Header.NumRecords = Chunk.Num();
+		Header.UncompressedSize = UncompressedSize;
+		Header.CompressedSize = CompressedSize;
+
+		File->Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header));
+		File->Write(Compressed.GetData(), CompressedSize);
+
+		NumWritten += Chunk.Num();
+		BytesWritten += sizeof(Header) + CompressedSize;
+		Chunk.Reset();
+	}
+
+	TCircularQueue<FEliteTrajectoryTransition> Queue;
+
+	IFileHandle* File;
+	const int32 ChunkRecords;
+
+	FEvent* WakeEvent;
+	FRunnableThread* Thread = nullptr;
+	TAtomic<bool> bStopping{ false };
+
+	/** Writer thread only */
+	TArray<FEliteTrajectoryRecord> Chunk;
+	TArray<uint8> Compressed;
+
+	TAtomic<int64> NumWritten{ 0 };
+	TAtomic<int64> BytesWritten{ 0 };
+};
+
+// ========== RECORDER ==========
+
+UEliteTrajectoryRecorder::~UEliteTrajectoryRecorder()
+{
+}
+
+UEliteTrajectoryRecorder* UEliteTrajectoryRecorder::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<UEliteTrajectoryRecorder>() : nullptr;
+}
+
+void UEliteTrajectoryRecorder::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("SoulstrikeRecordTrajectories")))
+	{
+		GEliteTrajectoryRecord = 1;
+	}
+}
+
+void UEliteTrajectoryRecorder::Deinitialize()
+{
+	StopRecording();
+
+	Super::Deinitialize();
+}
+
+TStatId UEliteTrajectoryRecorder::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEliteTrajectoryRecorder, STATGROUP_Tickables);
+}
+
+void UEliteTrajectoryRecorder::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const bool bWantsRecording = GEliteTrajectoryRecord != 0;
+	if (bWantsRecording != IsRecording())
+	{
+		if (bWantsRecording)
+		{
+			StartRecording();
+		}
+		else
+		{
+			StopRecording();
+		}
+	}
+
+	// One wake per frame instead of one per transition
+	if (Writer)
+	{
+		Writer->Wake();
+	}
+}
+
+void UEliteTrajectoryRecorder::Record(const FEliteTrajectoryTransition& Transition)
+{
+	if (!Writer)
+		return;
+
+	if (Writer->Enqueue(Transition))
+	{
+		++NumQueued;
+	}
+	else
+	{
+		++NumDropped;
+		SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeAI, Warning, "Trajectory transitions dropped (writer behind)", 1.0f);
+	}
+}
+
+void UEliteTrajectoryRecorder::StartRecording()
+{
+	const FString Directory = FPaths::ProjectSavedDir() / TEXT("Trajectories");
+	// Map package in the name: simulation worlds recording side by side get their own files
+	const FString Filename = Directory / FString::Printf(TEXT("Trajectories_%s_%s.sstraj"),
+		*FDateTime::Now().ToString(), *FPackageName::GetShortName(GetWorld()->GetOutermost()));
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.CreateDirectoryTree(*Directory);
+
+	IFileHandle* File = PlatformFile.OpenWrite(*Filename);
+	if (!File)
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("EliteTrajectoryRecorder: Could not open %s, recording disabled"), *Filename);
+		GEliteTrajectoryRecord = 0;
+		return;
+	}
+
+	NumQueued = 0;
+	NumDropped = 0;
+	Writer = MakeUnique<FEliteTrajectoryWriter>(File, GEliteTrajectoryChunkRecords);
+
+	UE_LOG(LogSoulstrikeAI, Log, TEXT("EliteTrajectoryRecorder: Recording to %s"), *Filename);
+}
+
+void UEliteTrajectoryRecorder::StopRecording()
+{
+	if (!Writer)
+		return;
+
+	// Joins the writer thread, which flushes the last partial chunk first
+	Writer.Reset();
+
+	UE_LOG(LogSoulstrikeAI, Log, TEXT("EliteTrajectoryRecorder: Stopped after %lld transitions (%lld dropped)"), NumQueued, NumDropped);
+}
+
+void UEliteTrajectoryRecorder::DumpStats(UWorld* World)
+{
+	UEliteTrajectoryRecorder* Recorder = Get(World);
+	if (!Recorder)
+		return;
+
+	if (!Recorder->Writer)
+	{
+		UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteTrajectoryRecorder: not recording (last run: %lld queued, %lld dropped)"),
+			Recorder->NumQueued, Recorder->NumDropped);
+		return;
+	}
+
+	const int64 NumWritten = Recorder->Writer->GetNumWritten();
+	const int64 BytesWritten = Recorder->Writer->GetBytesWritten();
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("EliteTrajectoryRecorder: %lld queued, %lld dropped, %lld written in %.1f KB (%.1f bytes/transition)"),
+		Recorder->NumQueued, Recorder->NumDropped, NumWritten, BytesWritten / 1024.0,
+		NumWritten > 0 ? static_cast<double>(BytesWritten) / NumWritten : 0.0);
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SoulstrikeTickableWorldSubsystem.h"
+#include "RLTypes.h"
+#include "EliteTrajectoryRecorder.generated.h"
+
+class FEliteTrajectoryWriter;
+
+/**
+ * One learned transition as the game thread hands it over: full precision, no packing.
+ */
+struct FEliteTrajectoryTransition
+{
+	FRLState State;
+	FRLState NextState;
+
+	/** Game time of the step that observed NextState */
+	float Time = 0.0f;
+
+	float Reward = 0.0f;
+
+	/** Owner's UObject unique id */
+	uint32 EliteId = 0;
+
+	/** EEliteType, EEliteAction (the action taken in State) */
+	uint8 EliteType = 0;
+	uint8 Action = 0;
+};
+
+/**
+ * On-disk transition: state floats and the reward as half floats, the state bools as bits.
+ * Written as-is into chunks, so the layout is part of the file format (bump Version when it changes).
+ */
+struct FEliteTrajectoryRecord
+{
+	static constexpr int32 NumStateFloats = 11;
+
+	float Time;
+	uint32 EliteId;
+
+	/** FFloat16 encodings */
+	uint16 Reward;
+	uint16 State[NumStateFloats];
+	uint16 NextState[NumStateFloats];
+
+	uint8 EliteType;
+	uint8 Action;
+
+	/** Bits 0-2: State beyond range / took damage / line of sight, bits 3-5: the same for NextState */
+	uint8 Flags;
+	uint8 Padding[3];
+
+	static FEliteTrajectoryRecord Pack(const FEliteTrajectoryTransition& Transition);
+	void Unpack(FEliteTrajectoryTransition& OutTransition) const;
+};
+
+static_assert(sizeof(FEliteTrajectoryRecord) == 60, "FEliteTrajectoryRecord is a file format - keep its size fixed");
+
+/**
+ * Trajectory file layout: FEliteTrajectoryFileHeader, then any number of chunks, each an
+ * FEliteTrajectoryChunkHeader followed by CompressedSize bytes of zlib data that inflate to
+ * NumRecords packed FEliteTrajectoryRecord.
+ */
+struct FEliteTrajectoryFileHeader
+{
+	static constexpr uint32 ExpectedMagic = 0x4A545353; // "SSTJ"
+	static constexpr uint32 CurrentVersion = 1;
+
+	uint32 Magic = ExpectedMagic;
+	uint32 Version = CurrentVersion;
+	uint32 RecordSize = sizeof(FEliteTrajectoryRecord);
+	uint32 Reserved = 0;
+};
+
+struct FEliteTrajectoryChunkHeader
+{
+	uint32 NumRecords = 0;
+	uint32 UncompressedSize = 0;
+	uint32 CompressedSize = 0;
+};
+
+/**
+ * Elite Trajectory Recorder - optional stream of every learned elite transition to disk.
+ * Elites push full-precision transitions into a lock-free single-producer queue from the game
+ * thread; a writer thread packs them, compresses fixed-size chunks and appends them to
+ * Saved/Trajectories/. Nothing is recorded unless Soulstrike.AI.Trajectory.Record is set
+ * (or the game runs with -SoulstrikeRecordTrajectories). When the writer falls behind and the
+ * queue fills, new transitions are dropped and counted rather than stalling the frame.
+ */
+UCLASS()
+class SOULSTRIKE_API UEliteTrajectoryRecorder : public USoulstrikeTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Defined with the writer, which is only complete in the .cpp */
+	virtual ~UEliteTrajectoryRecorder();
+
+	/** Get the recorder for a world (null for non-game worlds) */
+	static UEliteTrajectoryRecorder* Get(const UWorld* World);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	bool IsRecording() const { return Writer.IsValid(); }
+
+	/** Queue a transition (game thread only) */
+	void Record(const FEliteTrajectoryTransition& Transition);
+
+	/** Print recorder counters to the log (Soulstrike.AI.Trajectory.Stats) */
+	static void DumpStats(UWorld* World);
+
+private:
+	void StartRecording();
+	void StopRecording();
+
+	TUniquePtr<FEliteTrajectoryWriter> Writer;
+
+	/** Transitions queued / dropped on a full queue since recording started */
+	int64 NumQueued = 0;
+	int64 NumDropped = 0;
+};
@@ -0,0 +1,72 @@
+#include "EliteWorldSnapshot.h"
+#include "EliteArchetypeComponent.h"
+#include "SoulstrikeStats.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Character.h"
+#include "AIController.h"
+#include "Kismet/GameplayStatics.h"
+
+void FEliteWorldSnapshot::Capture(UWorld* World)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_WorldSnapshot);
+
+	Characters.Reset();
+
+	if (!World)
+		return;
+
+	if (const ACharacter* Player = UGameplayStatics::GetPlayerCharacter(World, 0))
+	{
+		PlayerLocation = Player->GetActorLocation();
+	}
+
+	for (TActorIterator<ACharacter> It(World); It; ++It)
+	{
+		const ACharacter* Character = *It;
+		if (!Character || Character->IsPendingKillOrUnreachable())
+			continue;
+
+		const float HealthPercentage = ReadHealthPercentage(Character);
+		if (HealthPercentage <= 0.0f)
+			continue;
+
+		FEliteSnapshotCharacter& Entry = Characters.AddDefaulted_GetRef();
+		Entry.Character = Character;
+		Entry.Location = Character->GetActorLocation();
+		Entry.HealthPercentage = HealthPercentage;
+		Entry.bIsAIControlled = Cast<AAIController>(Character->GetController()) != nullptr;
+
+		if (const FEliteArchetype* Archetype = UEliteArchetypeComponent::FindArchetype(Character))
+		{
+			Entry.RoleFlags = Archetype->RoleFlags;
+		}
+	}
+}
+
+float FEliteWorldSnapshot::ReadHealthPercentage(const ACharacter* Character)
+{
+	if (!Character || !Character->IsValidLowLevel() || Character->IsPendingKillOrUnreachable())
+		return 0.0f;
+
+	// Try to get CurrentHealth and MaxHealth from Blueprint
+	UClass* CharClass = Character->GetClass();
+	if (!CharClass || !CharClass->IsValidLowLevel())
+		return 0.0f;
+
+	FProperty* CurrentHealthProp = CharClass->FindPropertyByName(TEXT("CurrentHealth"));
+	FProperty* MaxHealthProp = CharClass->FindPropertyByName(TEXT("MaxHealth"));
+
+	if (CurrentHealthProp && MaxHealthProp)
+	{
+		const float* CurrentHealthPtr = CurrentHealthProp->ContainerPtrToValuePtr<float>(Character);
+		const float* MaxHealthPtr = MaxHealthProp->ContainerPtrToValuePtr<float>(Character);
+
+		if (CurrentHealthPtr && MaxHealthPtr && *MaxHealthPtr > 0.0f)
+		{
+			return FMath::Clamp(*CurrentHealthPtr / *MaxHealthPtr, 0.0f, 1.0f);
+		}
+	}
+
+	return 1.0f; // Default assumption
+}
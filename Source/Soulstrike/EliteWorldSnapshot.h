@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class ACharacter;
+class UWorld;
+
+/**
+ * One living character as seen at the start of the AI frame
+ */
+struct FEliteSnapshotCharacter
+{
+	const ACharacter* Character = nullptr;
+	FVector Location = FVector::ZeroVector;
+	float HealthPercentage = 1.0f;
+
+	/** Driven by an AI controller (elites and swarm - what the RL state counts as allies) */
+	bool bIsAIControlled = false;
+
+	/** EEliteRoleFlags from the elite's archetype (0 for non-elites) */
+	int32 RoleFlags = 0;
+};
+
+/**
+ * Read-only copy of the world data elite states are built from. Captured once per frame on the
+ * game thread so every elite's state can be built in parallel without touching actors.
+ */
+struct SOULSTRIKE_API FEliteWorldSnapshot
+{
+	/** Living characters (health > 0) */
+	TArray<FEliteSnapshotCharacter> Characters;
+
+	/** Player location at capture time */
+	FVector PlayerLocation = FVector::ZeroVector;
+
+	/** Fill the snapshot from the world (game thread only) */
+	void Capture(UWorld* World);
+
+	/** Health percentage from the Blueprint CurrentHealth/MaxHealth variables (1 if the Blueprint has none) */
+	static float ReadHealthPercentage(const ACharacter* Character);
+};
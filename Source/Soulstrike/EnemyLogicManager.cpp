@@ -1,5 +1,7 @@
 #include "EnemyLogicManager.h"
 #include "SoulstrikeGameInstance.h"
+#include "EliteCombatEventBus.h"
+#include "SoulstrikeLog.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -16,17 +18,23 @@ void AEnemyLogicManager::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// Combat events from enemies are delivered here
+	if (UEliteCombatEventBus* CombatEvents = UEliteCombatEventBus::Get(GetWorld()))
+	{
+		CombatEvents->SetLogicManager(this);
+	}
+
 	// Get player reference
 	PlayerCharacter = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
 
 	if (PlayerCharacter)
 	{
 		LastPlayerPosition = PlayerCharacter->GetActorLocation();
-		UE_LOG(LogTemp, Log, TEXT("EnemyLogicManager: Player character found and tracked."));
+		UE_LOG(LogSoulstrikeAI, Log, TEXT("EnemyLogicManager: Player character found and tracked."));
 	}
 	else
 	{
-		UE_LOG(LogTemp, Warning, TEXT("EnemyLogicManager: Player character not found!"));
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("EnemyLogicManager: Player character not found!"));
 	}
 }
 
@@ -58,14 +66,21 @@ void AEnemyLogicManager::ReportDamageToPlayer(ACharacter* TargetPlayer, float Da
 {
 	if (!TargetPlayer)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("EnemyLogicManager: Attempted to damage null player!"));
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("EnemyLogicManager: Attempted to damage null player!"));
 		return;
 	}
 
-	// Log damage for debugging
-	FString SourceName = DamageSource ? DamageSource->GetName() : TEXT("Unknown");
-	UE_LOG(LogTemp, Log, TEXT("EnemyLogicManager: %s dealt %.1f damage to player"), *SourceName, Damage);
+	// Per-second summary for debugging
+	SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeAI, Log, "Damage reports to player", Damage);
 
 	// Broadcast event that Blueprint can listen to
 	OnDamagePlayerEvent.Broadcast(TargetPlayer, Damage, DamageSource);
 }
+
+void AEnemyLogicManager::ReportHealToAlly(ACharacter* TargetAlly, float HealAmount, AActor* HealSource)
+{
+	if (!TargetAlly)
+		return;
+
+	OnHealAllyEvent.Broadcast(TargetAlly, HealAmount, HealSource);
+}
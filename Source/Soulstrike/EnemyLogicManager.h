@@ -13,6 +13,15 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnDamagePlayerEvent,
 	float, Damage,
 	AActor*, DamageSource);
 
+/**
+ * Delegate for when an Elite heals an ally
+ * Blueprint can bind to this event
+ */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnHealAllyEvent,
+	ACharacter*, TargetAlly,
+	float, HealAmount,
+	AActor*, HealSource);
+
 /**
  * Enemy Logic Manager - Global manager that tracks the player and broadcasts information to all enemies.
  * Also handles combat events like damage reporting.
@@ -31,14 +40,22 @@ protected:
 public:	
 	virtual void Tick(float DeltaTime) override;
 
-	/** Called by Elites when they deal damage to the player */
+	/** Called when the player takes damage (enemies go through UEliteCombatEventBus, which reports once per frame) */
 	UFUNCTION(BlueprintCallable, Category = "Combat")
 	void ReportDamageToPlayer(ACharacter* TargetPlayer, float Damage, AActor* DamageSource);
 
+	/** Called when an ally is healed (delivered by UEliteCombatEventBus) */
+	UFUNCTION(BlueprintCallable, Category = "Combat")
+	void ReportHealToAlly(ACharacter* TargetAlly, float HealAmount, AActor* HealSource);
+
 	/** Event that Blueprint can bind to - fires when player takes damage */
 	UPROPERTY(BlueprintAssignable, Category = "Combat Events")
 	FOnDamagePlayerEvent OnDamagePlayerEvent;
 
+	/** Event that Blueprint can bind to - fires when an ally is healed */
+	UPROPERTY(BlueprintAssignable, Category = "Combat Events")
+	FOnHealAllyEvent OnHealAllyEvent;
+
 private:
 	/** Cached reference to the player character */
 	ACharacter* PlayerCharacter;
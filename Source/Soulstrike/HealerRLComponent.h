@@ -13,6 +13,6 @@ class SOULSTRIKE_API UHealerRLComponent : public URLComponent
 	GENERATED_BODY()
 
 protected:
-	virtual float CalculateReward() override;
+	virtual FEliteRewardFunction GetRewardFunction() const override;
 	virtual void PerformSecondaryAttackOnElite() override;
 };
@@ -1,18 +1,20 @@
 #include "QLearningBrain.h"
+#include "SoulstrikeStats.h"
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
 
 FQLearningBrain::FQLearningBrain()
 {
+	RandomStream.Initialize(FMath::Rand());
 }
 
 FQLearningBrain::~FQLearningBrain()
 {
 }
 
-FEliteStats FQLearningBrain::ReadStatsFromBlueprint(ACharacter* Character)
+FEliteStats FQLearningBrain::ReadStatsFromBlueprint(ACharacter* Character, const FEliteStats& Defaults)
 {
-	FEliteStats Stats;
+	FEliteStats Stats = Defaults;
 	
 	if (!Character)
 		return Stats;
@@ -34,12 +36,12 @@ FEliteStats FQLearningBrain::ReadStatsFromBlueprint(ACharacter* Character)
 	};
 
 	// Read all stats
-	Stats.AttackDamage = ReadFloatProperty(Character, TEXT("AttackDamage"), 10.0f);
-	Stats.MaxAttackRange = ReadFloatProperty(Character, TEXT("MaxAttackRange"), 500.0f);
-	Stats.AttackWindupDuration = ReadFloatProperty(Character, TEXT("AttackWindupDuration"), 0.3f);
-	Stats.AttackCooldown = ReadFloatProperty(Character, TEXT("AttackCooldown"), 0.5f);
-	Stats.MovementSpeed = ReadFloatProperty(Character, TEXT("MovementSpeed"), 400.0f);
-	Stats.HealAmount = ReadFloatProperty(Character, TEXT("HealAmount"), 50.0f);
+	Stats.AttackDamage = ReadFloatProperty(Character, TEXT("AttackDamage"), Defaults.AttackDamage);
+	Stats.MaxAttackRange = ReadFloatProperty(Character, TEXT("MaxAttackRange"), Defaults.MaxAttackRange);
+	Stats.AttackWindupDuration = ReadFloatProperty(Character, TEXT("AttackWindupDuration"), Defaults.AttackWindupDuration);
+	Stats.AttackCooldown = ReadFloatProperty(Character, TEXT("AttackCooldown"), Defaults.AttackCooldown);
+	Stats.MovementSpeed = ReadFloatProperty(Character, TEXT("MovementSpeed"), Defaults.MovementSpeed);
+	Stats.HealAmount = ReadFloatProperty(Character, TEXT("HealAmount"), Defaults.HealAmount);
 
 	return Stats;
 }
@@ -117,12 +119,14 @@ float FQLearningBrain::CalculateQValue(const FRLState& State, EEliteAction Actio
 
 EEliteAction FQLearningBrain::SelectAction(const FRLState& State, float Epsilon) const
 {
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_SelectAction);
+
 	// Epsilon-greedy policy
-	float RandomValue = FMath::FRand();
+	float RandomValue = RandomStream.FRand();
 	if (RandomValue < Epsilon)
 	{
 		// Explore: choose random action
-		int32 RandomIndex = FMath::RandRange(0, 5); // 6 actions
+		int32 RandomIndex = RandomStream.RandRange(0, 5); // 6 actions
 		return static_cast<EEliteAction>(RandomIndex);
 	}
 	else
@@ -148,6 +152,8 @@ EEliteAction FQLearningBrain::SelectAction(const FRLState& State, float Epsilon)
 
 void FQLearningBrain::UpdateWeights(const FRLState& OldState, EEliteAction Action, float Reward, const FRLState& NewState, float Alpha, float Gamma)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_UpdateWeights);
+
 	if (!Weights.Contains(Action))
 		return;
 
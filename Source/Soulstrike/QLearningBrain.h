@@ -48,8 +48,8 @@ public:
 
 	// ========== STATS POLLING ==========
 	
-	/** Read all elite stats from Blueprint properties */
-	static FEliteStats ReadStatsFromBlueprint(class ACharacter* Character);
+	/** Read all elite stats from Blueprint properties (Defaults fill in properties the Blueprint lacks) */
+	static FEliteStats ReadStatsFromBlueprint(class ACharacter* Character, const FEliteStats& Defaults = FEliteStats());
 
 	// ========== Q-LEARNING CORE ==========
 
@@ -65,10 +65,13 @@ public:
 	/** Extract feature values from a state */
 	static TMap<FName, float> ExtractFeatures(const FRLState& State);
 
+	/** Feature names used in Q-learning */
+	static TArray<FName> GetFeatureNames();
+
 private:
 	/** Weights for Q-value calculation: Action -> (FeatureName -> Weight) */
 	TMap<EEliteAction, TMap<FName, float>> Weights;
 
-	/** Feature names used in Q-learning */
-	static TArray<FName> GetFeatureNames();
+	/** Per-brain random stream so action selection can run on worker threads */
+	mutable FRandomStream RandomStream;
 };
@@ -1,19 +1,38 @@
 #include "RLComponent.h"
 #include "EliteEnemy.h"
-#include "EliteArcher.h"
-#include "EliteAssassin.h"
-#include "ElitePaladin.h"
-#include "EliteGiant.h"
-#include "EliteHealer.h"
-#include "EnemyLogicManager.h"
+#include "EliteArchetypeRegistry.h"
 #include "SoulstrikeGameInstance.h"
 #include "QLearningBrain.h"
 #include "WeightManager.h"
+#include "EliteTraceScheduler.h"
+#include "EliteSignificanceManager.h"
+#include "EliteWorldSnapshot.h"
+#include "EliteRewards.h"
+#include "EliteStatusEffectManager.h"
+#include "EliteCombatEventBus.h"
+#include "EliteCombatTimeline.h"
+#include "EliteDebugOverlay.h"
+#include "EliteTrajectoryRecorder.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeStats.h"
+#include "SoulstrikeTrace.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
-#include "DrawDebugHelpers.h"
 #include "AIController.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/IConsoleManager.h"
+
+static float GEliteDecisionChangeThreshold = 0.05f;
+static FAutoConsoleVariableRef CVarEliteDecisionChangeThreshold(
+	TEXT("Soulstrike.AI.Decision.ChangeThreshold"),
+	GEliteDecisionChangeThreshold,
+	TEXT("Elites choose a new action once a state feature moved this much since their last decision (0 = decide every step)."));
+
+static float GEliteDecisionMaxHoldSeconds = 1.0f;
+static FAutoConsoleVariableRef CVarEliteDecisionMaxHoldSeconds(
+	TEXT("Soulstrike.AI.Decision.MaxHoldSeconds"),
+	GEliteDecisionMaxHoldSeconds,
+	TEXT("Longest an elite keeps acting on one decision when nothing changes."));
 
 URLComponent::URLComponent()
 {
@@ -32,6 +51,9 @@ URLComponent::URLComponent()
 	AttackCooldown = 0.5f;
 	MovementSpeed = 400.0f; 
 
+	// Path query results are dropped once this component is gone
+	MoveCommander.SetOwner(this);
+
 	// Debug
 	bDebugMode = false;
 
@@ -48,10 +70,31 @@ URLComponent::URLComponent()
 	MinActionDuration = 0.3f; // Hold each action for at least 0.3 seconds
 	PendingAction = EEliteAction::Move_Towards_Player;
 
+	// Decisions
+	DecisionAttackState = EAttackState::Normal;
+	bHasDecision = false;
+	DecisionHoldTime = 0.0f;
+	DecisionReward = 0.0f;
+	DecisionSteps = 0;
+	bDecisionLearns = false;
+
 	// Attack state machine
 	AttackState = EAttackState::Normal;
 	AttackTimer = 0.0f;
 	HealTarget = nullptr;
+	Significance = EEliteSignificance::High;
+
+	// Step scratch
+	StepDeltaTime = 0.0f;
+	StepOwnerLocation = FVector::ZeroVector;
+	StepHealthPercentage = 1.0f;
+	bStepLineOfSight = true;
+	bStepLearns = false;
+	bStepRecords = false;
+	bStepRewardReady = false;
+	bStepDecides = false;
+	StepActivePoisons = 0;
+	StepSelectedAction = EEliteAction::Move_Towards_Player;
 
 	// Delta tracking
 	PreviousDPS = 0.0f;
@@ -76,7 +119,7 @@ void URLComponent::BeginPlay()
 	if (GameInstance)
 	{
 		GameInstance->OnPlayerPositionUpdated.AddDynamic(this, &URLComponent::OnPlayerPositionUpdated);
-		UE_LOG(LogTemp, Log, TEXT("RLComponent: Subscribed to player position updates."));
+		UE_LOG(LogSoulstrikeAI, Log, TEXT("RLComponent: Subscribed to player position updates."));
 	}
 	
 	// Cache initial player location
@@ -88,21 +131,36 @@ void URLComponent::BeginPlay()
 
 void URLComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	// Stop tracking line of sight for this elite
+	if (UEliteTraceScheduler* TraceScheduler = UEliteTraceScheduler::Get(GetWorld()))
+	{
+		TraceScheduler->RemoveRequester(OwnerCharacter);
+	}
+
 	// Save weights to WeightManager when this elite dies (soul preserved)
 	if (Brain.IsValid())
 	{
 		UWeightManager* WeightMgr = UWeightManager::Get(GetWorld());
 		if (WeightMgr)
 		{
-			WeightMgr->SaveWeights(EliteType, Brain->GetWeights());
-			UE_LOG(LogTemp, Log, TEXT("RLComponent: %s saved learned weights for future souls"), *OwnerCharacter->GetName());
+			// Parallel simulation worlds pool their learning; a normal game lets the last soul win
+			const USoulstrikeGameInstance* GameInstance = Cast<USoulstrikeGameInstance>(GetWorld()->GetGameInstance());
+			if (GameInstance && GameInstance->HasSimWorlds())
+			{
+				WeightMgr->MergeWeights(EliteType, Brain->GetWeights(), SpawnWeights);
+			}
+			else
+			{
+				WeightMgr->SaveWeights(EliteType, Brain->GetWeights());
+			}
+			UE_LOG(LogSoulstrikeAI, Log, TEXT("RLComponent: %s saved learned weights for future souls"), *OwnerCharacter->GetName());
 		}
 	}
 
 	Super::EndPlay(EndPlayReason);
 }
 
-void URLComponent::Initialize(APawn* InPawn)
+void URLComponent::Initialize(APawn* InPawn, const FEliteArchetype& InArchetype)
 {
 	OwnerCharacter = Cast<ACharacter>(InPawn);
 	if (!OwnerCharacter)
@@ -122,46 +180,12 @@ void URLComponent::Initialize(APawn* InPawn)
 	};
 	PreviousHealth = ReadFloatProperty(OwnerCharacter, TEXT("CurrentHealth"), 100.0f);
 
-	// Detect elite type by name for behavior logic (poison, healing, etc.)
-	FString PawnName = InPawn->GetName();
-	
-	UClass* EliteClass = nullptr;
-	if (PawnName.Contains("Archer"))
-	{
-		EliteClass = AEliteArcher::StaticClass();
-		EliteType = EEliteType::Archer;
-	}
-	else if (PawnName.Contains("Assassin"))
-	{
-		EliteClass = AEliteAssassin::StaticClass();
-		EliteType = EEliteType::Assassin;
-	}
-	else if (PawnName.Contains("Paladin"))
-	{
-		EliteClass = AElitePaladin::StaticClass();
-		EliteType = EEliteType::Paladin;
-	}
-	else if (PawnName.Contains("Giant"))
-	{
-		EliteClass = AEliteGiant::StaticClass();
-		EliteType = EEliteType::Giant;
-	}
-	else if (PawnName.Contains("Healer"))
-	{
-		EliteClass = AEliteHealer::StaticClass();
-		EliteType = EEliteType::Healer;
-	}
-	else
-	{
-		EliteClass = AEliteEnemy::StaticClass();
-		EliteType = EEliteType::Archer; // Default
-	}
+	// Elite type and behavior object come from the archetype resolved at spawn
+	Archetype = MakeShared<FEliteArchetype>(InArchetype);
+	EliteType = InArchetype.EliteType;
 
-	// Store elite class for type checking (poison, healing)
-	if (EliteClass)
-	{
-		EliteBehavior = Cast<AEliteEnemy>(EliteClass->GetDefaultObject());
-	}
+	UClass* EliteClass = InArchetype.BehaviorClass ? InArchetype.BehaviorClass.Get() : AEliteEnemy::StaticClass();
+	EliteBehavior = Cast<AEliteEnemy>(EliteClass->GetDefaultObject());
 
 	// Read initial stats
 	PollAndUpdateStats();
@@ -174,16 +198,17 @@ void URLComponent::Initialize(APawn* InPawn)
 	if (WeightMgr && WeightMgr->HasWeights(EliteType))
 	{
 		Brain->LoadWeights(WeightMgr->LoadWeights(EliteType));
-		UE_LOG(LogTemp, Log, TEXT("RLComponent: %s loaded learned weights from previous souls"), *OwnerCharacter->GetName());
+		UE_LOG(LogSoulstrikeAI, Log, TEXT("RLComponent: %s loaded learned weights from previous souls"), *OwnerCharacter->GetName());
 	}
 	else
 	{
 		// First spawn of this elite type - initialize with default biased weights
 		Brain->InitializeWeights();
-		UE_LOG(LogTemp, Log, TEXT("RLComponent: %s initialized with fresh weights (first soul)"), *OwnerCharacter->GetName());
+		UE_LOG(LogSoulstrikeAI, Log, TEXT("RLComponent: %s initialized with fresh weights (first soul)"), *OwnerCharacter->GetName());
 	}
+	SpawnWeights = Brain->GetWeights();
 
-	UE_LOG(LogTemp, Log, TEXT("RLComponent: Initialized %s (HP: %.0f, Damage: %.0f, Range: %.0f, Windup: %.2fs, Cooldown: %.2fs)"), 
+	UE_LOG(LogSoulstrikeAI, Log, TEXT("RLComponent: Initialized %s (HP: %.0f, Damage: %.0f, Range: %.0f, Windup: %.2fs, Cooldown: %.2fs)"), 
 		*OwnerCharacter->GetName(), PreviousHealth, AttackDamage, MaxAttackRange, AttackWindupDuration, AttackCooldown);
 }
 
@@ -193,7 +218,8 @@ void URLComponent::PollAndUpdateStats()
 		return;
 
 	// Read all stats from Blueprint using QLearningBrain helper
-	FEliteStats NewStats = FQLearningBrain::ReadStatsFromBlueprint(OwnerCharacter);
+	FEliteStats NewStats = FQLearningBrain::ReadStatsFromBlueprint(OwnerCharacter,
+		Archetype ? Archetype->DefaultStats.ToEliteStats() : FEliteStats());
 
 	// Apply movement speed if changed
 	UCharacterMovementComponent* MovementComp = OwnerCharacter->GetCharacterMovement();
@@ -212,9 +238,32 @@ void URLComponent::PollAndUpdateStats()
 
 void URLComponent::ExecuteRLStep(float DeltaTime)
 {
-	if (!OwnerCharacter || !IsCharacterAlive(OwnerCharacter))
+	if (!BeginRLStep(DeltaTime))
 		return;
 
+	// Stepping a single elite on its own - capture the world just for it
+	FEliteWorldSnapshot Snapshot;
+	Snapshot.Capture(GetWorld());
+
+	BuildStateFromSnapshot(Snapshot);
+	RunInference();
+	ApplyRLStep();
+}
+
+bool URLComponent::BeginRLStep(float DeltaTime)
+{
+	if (!OwnerCharacter || !IsCharacterAlive(OwnerCharacter))
+		return false;
+
+	SOULSTRIKE_TRACE_EVENT(EliteStepBegin, OwnerCharacter->GetUniqueID(), static_cast<uint8>(EliteType), static_cast<uint8>(Significance));
+
+	StepDeltaTime = DeltaTime;
+	bStepRewardReady = false;
+
+	// Recording wants every transition, including those of elites too insignificant to learn
+	const UEliteTrajectoryRecorder* Recorder = UEliteTrajectoryRecorder::Get(GetWorld());
+	bStepRecords = Recorder && Recorder->IsRecording();
+
 	// Update cached player location
 	if (PlayerCharacter)
 	{
@@ -233,25 +282,14 @@ void URLComponent::ExecuteRLStep(float DeltaTime)
 	float CurrentTime = GetWorld()->GetTimeSeconds();
 	CleanupDamageHistory(CurrentTime);
 
-	// Update poison ticks (virtual function - will be overridden by Assassin)
-	UpdatePoisons(DeltaTime);
-
 	// === ATTACK STATE MACHINE UPDATE ===
 	if (AttackState == EAttackState::Attacking)
 	{
-		AttackTimer += DeltaTime;
-		if (AttackTimer >= AttackWindupDuration)
-		{
-			// Attack windup finished - now check if player is still in range and apply damage
-			OnAttackWindupComplete();
-			
-			// Enter cooldown
-			AttackState = EAttackState::OnCooldown;
-			AttackTimer = 0.0f;
-		}
-		// Skip RL execution during attack windup, but still draw debug
-		if (bDebugMode) DebugDraw();
-		return;
+		// The combat timeline resolves the windup and puts us on cooldown.
+		// Skip RL execution during attack windup, but still report debug
+		if (bDebugMode && UEliteSignificanceManager::AllowsDebugDraw(Significance)) WriteDebugRecord();
+		SOULSTRIKE_TRACE_EVENT(EliteStepEnd, OwnerCharacter->GetUniqueID(), static_cast<uint8>(LastAction), LastReward, false);
+		return false;
 	}
 	else if (AttackState == EAttackState::OnCooldown)
 	{
@@ -268,14 +306,14 @@ void URLComponent::ExecuteRLStep(float DeltaTime)
 	TimeSinceLastPrimaryAttack += DeltaTime;
 	TimeSinceLastDamageTaken += DeltaTime;
 	ActionPersistenceTimer += DeltaTime;
+	DecisionHoldTime += DeltaTime;
 
 	// Check if we took damage this frame
 	float CurrentHealth = GetCharacterHealthPercentage(OwnerCharacter) * 100.0f;
 	if (CurrentHealth < PreviousHealth)
 	{
 		float HealthLost = PreviousHealth - CurrentHealth;
-		UE_LOG(LogTemp, Warning, TEXT("RLComponent: %s took %.1f damage! (%.1f -> %.1f)"),
-			*OwnerCharacter->GetName(), HealthLost, PreviousHealth, CurrentHealth);
+		SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeAI, Log, "Elite damage taken", HealthLost);
 		TimeSinceLastDamageTaken = 0.0f;
 	}
 	PreviousHealth = CurrentHealth;
@@ -287,41 +325,158 @@ void URLComponent::ExecuteRLStep(float DeltaTime)
 	}
 
 	// Capture previous step metrics BEFORE building new state
-	float PrevDistNorm = CurrentState.DistanceToPlayer;
-	float PrevDPSCapture = GetAverageDPS();
-	float PrevHPSCapture = GetAverageHPS();
+	PreviousDistanceToPlayer = CurrentState.DistanceToPlayer;
+	PreviousDPS = GetAverageDPS();
+	PreviousHPS = GetAverageHPS();
 
 	// Save previous state
 	PreviousState = CurrentState;
 
-	// Build current state
-	CurrentState = BuildState();
+	// Everything the state needs from our own actor is read here, on the game thread
+	StepOwnerLocation = OwnerCharacter->GetActorLocation();
+	StepHealthPercentage = CurrentHealth / 100.0f;
+	bStepLineOfSight = HasLineOfSightToPlayer();
+	StepActivePoisons = GetNumActivePoisons();
 
-	// Store delta tracking values using captured previous metrics
-	PreviousDistanceToPlayer = PrevDistNorm;
-	PreviousDPS = PrevDPSCapture;
-	PreviousHPS = PrevHPSCapture;
+	return true;
+}
 
-	// If this is not the first step, update weights
-	if (PreviousState.SelfHealthPercentage > 0.0f)
+void URLComponent::BuildStateFromSnapshot(const FEliteWorldSnapshot& Snapshot)
+{
+	SOULSTRIKE_TRACE_SCOPE(SoulstrikeAI_BuildStateFromSnapshot);
+
+	CurrentState = BuildState(Snapshot, RewardContext.ClosestAllies);
+
+	// Everything the reward reads, so it never has to look at the world
+	RewardContext.CurrentState = CurrentState;
+	RewardContext.PreviousState = PreviousState;
+	RewardContext.LastAction = LastAction;
+	RewardContext.AttackState = AttackState;
+	RewardContext.MaxAttackRange = MaxAttackRange;
+	RewardContext.ActualDistanceToPlayer = ActualDistanceToPlayer;
+	RewardContext.PreviousDistanceToPlayer = PreviousDistanceToPlayer;
+	RewardContext.CurrentDPS = GetAverageDPS();
+	RewardContext.PreviousDPS = PreviousDPS;
+	RewardContext.CurrentHPS = GetAverageHPS();
+	RewardContext.PreviousHPS = PreviousHPS;
+	RewardContext.NumActivePoisons = StepActivePoisons;
+
+	// If this is not the first step, learn from the transition (low significance elites only run inference)
+	const bool bHasTransition = PreviousState.SelfHealthPercentage > 0.0f;
+	bStepLearns = bHasTransition && UEliteSignificanceManager::AllowsLearning(Significance);
+	bStepRecords = bStepRecords && bHasTransition;
+}
+
+const FEliteRewardProgram* URLComponent::GetBatchedRewardProgram() const
+{
+	// Debugging wants the per-term breakdown, which only the single-elite path records
+	return (bStepLearns || bStepRecords) && !bDebugMode ? GetRewardProgram() : nullptr;
+}
+
+void URLComponent::SetStepReward(float Reward)
+{
+	LastReward = Reward;
+	bStepRewardReady = true;
+}
+
+void URLComponent::RunInference()
+{
+	SOULSTRIKE_TRACE_SCOPE(SoulstrikeAI_RunInference);
+
+	if ((bStepLearns || bStepRecords) && !bStepRewardReady)
 	{
-		float Reward = CalculateReward();
-		
-		// Log reward if significant health change
+		RewardBreakdown.Reset();
+		LastReward = EvaluateReward(bDebugMode ? &RewardBreakdown : nullptr);
+	}
+
+	if (bStepLearns)
+	{
+		// Fold this step into the return of the decision being held
+		DecisionReward += FMath::Pow(Gamma, DecisionSteps) * LastReward;
+		++DecisionSteps;
+	}
+	else
+	{
+		bDecisionLearns = false;
+	}
+
+	bStepDecides = ShouldDecide();
+	if (!bStepDecides)
+	{
+		// Nothing meaningful changed - keep acting on the last decision
+		StepSelectedAction = LastAction;
+		return;
+	}
+
+	if (bStepLearns && bHasDecision && bDecisionLearns)
+	{
+		// Semi-MDP update: the reward summed over the held steps, bootstrapped past all of them
+		Brain->UpdateWeights(DecisionState, LastAction, DecisionReward, CurrentState, Alpha, FMath::Pow(Gamma, DecisionSteps));
+	}
+
+	// Use Brain to select action
+	StepSelectedAction = Brain->SelectAction(CurrentState, Epsilon);
+
+	DecisionState = CurrentState;
+	DecisionAttackState = AttackState;
+	bHasDecision = true;
+	DecisionHoldTime = 0.0f;
+	DecisionReward = 0.0f;
+	DecisionSteps = 0;
+	bDecisionLearns = true;
+}
+
+bool URLComponent::ShouldDecide() const
+{
+	if (!bHasDecision || GEliteDecisionChangeThreshold <= 0.0f)
+		return true;
+
+	// Attacks fire once, so the step after one always chooses again
+	if (LastAction == EEliteAction::Primary_Attack || LastAction == EEliteAction::Secondary_Attack)
+		return true;
+
+	if (AttackState != DecisionAttackState || DecisionHoldTime >= GEliteDecisionMaxHoldSeconds)
+		return true;
+
+	return CurrentState.GetMaxDifference(DecisionState) >= GEliteDecisionChangeThreshold;
+}
+
+void URLComponent::ApplyRLStep()
+{
+	SOULSTRIKE_TRACE_SCOPE(SoulstrikeAI_ApplyRLStep);
+
+	if (bStepLearns)
+	{
+		// Summarize rewards on steps with a significant health change
 		float HealthDelta = CurrentState.SelfHealthPercentage - PreviousState.SelfHealthPercentage;
 		if (FMath::Abs(HealthDelta) > 0.01f)
 		{
-			UE_LOG(LogTemp, Log, TEXT("RLComponent: %s health delta: %.3f, reward: %.2f"),
-				*OwnerCharacter->GetName(), HealthDelta, Reward);
+			SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeAI, Verbose, "Elite reward on health change", LastReward);
+		}
+
+		if (bDebugMode)
+		{
+			UE_LOG(LogSoulstrikeAI, Verbose, TEXT("%s reward: %sTotal=%.2f Dist=%.2f dDist=%.1f"), *GetClass()->GetName(),
+				*RewardBreakdown.ToString(), LastReward, CurrentState.DistanceToPlayer, RewardContext.GetDeltaDistance());
 		}
-		
-		// Use Brain to update weights
-		Brain->UpdateWeights(PreviousState, LastAction, Reward, CurrentState, Alpha, Gamma);
-		LastReward = Reward;
 	}
 
-	// Use Brain to select action
-	EEliteAction SelectedAction = Brain->SelectAction(CurrentState, Epsilon);
+	// LastAction is still the action taken in PreviousState here
+	UEliteTrajectoryRecorder* Recorder = bStepRecords ? UEliteTrajectoryRecorder::Get(GetWorld()) : nullptr;
+	if (Recorder && Recorder->IsRecording())
+	{
+		FEliteTrajectoryTransition Transition;
+		Transition.State = PreviousState;
+		Transition.NextState = CurrentState;
+		Transition.Time = GetWorld()->GetTimeSeconds();
+		Transition.Reward = LastReward;
+		Transition.EliteId = OwnerCharacter->GetUniqueID();
+		Transition.EliteType = static_cast<uint8>(EliteType);
+		Transition.Action = static_cast<uint8>(LastAction);
+		Recorder->Record(Transition);
+	}
+
+	EEliteAction SelectedAction = StepSelectedAction;
 
 	// If attack action selected, check if can actually attack
 	if (SelectedAction == EEliteAction::Primary_Attack || SelectedAction == EEliteAction::Secondary_Attack)
@@ -340,36 +495,47 @@ void URLComponent::ExecuteRLStep(float DeltaTime)
 			ActionPersistenceTimer = 0.0f;
 		}
 		
-		ExecuteAction(SelectedAction, DeltaTime);
+		ExecuteAction(SelectedAction, StepDeltaTime);
 		LastAction = SelectedAction;
 		PendingAction = SelectedAction;
 	}
 	else
 	{
-		ExecuteAction(LastAction, DeltaTime);
+		ExecuteAction(LastAction, StepDeltaTime);
 	}
 
-	// Always draw debug when enabled
-	if (bDebugMode)
+	// Only elites near the player report; the debug overlay then picks which of them are drawn
+	if (bDebugMode && UEliteSignificanceManager::AllowsDebugDraw(Significance))
 	{
-		DebugDraw();
+		WriteDebugRecord();
 	}
+
+	if (bStepDecides)
+	{
+		INC_DWORD_STAT(STAT_SoulstrikeAI_RLDecisions);
+		CSV_CUSTOM_STAT(SoulstrikeAI, RLDecisions, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	SOULSTRIKE_TRACE_EVENT(EliteStepEnd, OwnerCharacter->GetUniqueID(), static_cast<uint8>(LastAction), LastReward, bStepDecides);
 }
 
-FRLState URLComponent::BuildState()
+FRLState URLComponent::BuildState(const FEliteWorldSnapshot& Snapshot, TArray<FEliteRewardAlly, TInlineAllocator<3>>& OutClosestAllies)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_BuildState);
+
 	FRLState State;
+	OutClosestAllies.Reset();
 
 	if (!OwnerCharacter || !PlayerCharacter)
 		return State;
 
 	// Self stats
-	State.SelfHealthPercentage = GetCharacterHealthPercentage(OwnerCharacter);
+	State.SelfHealthPercentage = StepHealthPercentage;
 	State.TimeSinceLastAttack = FMath::Clamp(TimeSinceLastPrimaryAttack / 5.0f, 0.0f, 1.0f);
 	State.bTookDamageRecently = (TimeSinceLastDamageTaken < 1.0f);
 
 	// Distance to player
-	float ActualDistance = FVector::Dist(OwnerCharacter->GetActorLocation(), CachedPlayerLocation);
+	float ActualDistance = FVector::Dist(StepOwnerLocation, CachedPlayerLocation);
 	ActualDistanceToPlayer = ActualDistance; // Store actual distance for reward calculations
 	State.bIsBeyondMaxRange = (ActualDistance > MaxAttackRange);
 	State.DistanceToPlayer = FMath::Clamp(ActualDistance / MaxAttackRange, 0.0f, 1.0f);
@@ -377,44 +543,72 @@ FRLState URLComponent::BuildState()
 	// Player stats
 	State.PlayerHealthPercentage = 1.0f; // TODO: Get actual player health
 
-	// Line of sight
-	State.bHasLineOfSightToPlayer = HasLineOfSightToPlayer();
+	// Line of sight (queried on the game thread)
+	State.bHasLineOfSightToPlayer = bStepLineOfSight;
+
+	// Allies - one pass over the snapshot keeping the closest 3 and counting the nearby ones
+	const float NearbyRadiusSq = FMath::Square(1000.0f);
+	const FEliteSnapshotCharacter* ClosestAllies[3] = { nullptr, nullptr, nullptr };
+	float ClosestDistancesSq[3] = { FLT_MAX, FLT_MAX, FLT_MAX };
+	int32 NearbyCount = 0;
 
-	// Allies
-	TArray<ACharacter*> ClosestAllies;
-	FindClosestAllies(ClosestAllies, 3);
+	for (const FEliteSnapshotCharacter& Ally : Snapshot.Characters)
+	{
+		if (!Ally.bIsAIControlled || Ally.Character == OwnerCharacter)
+			continue;
+
+		const float DistanceSq = FVector::DistSquared(StepOwnerLocation, Ally.Location);
+		if (DistanceSq <= NearbyRadiusSq)
+		{
+			NearbyCount++;
+		}
+
+		// Insertion into the sorted top 3
+		for (int32 i = 0; i < 3; ++i)
+		{
+			if (DistanceSq < ClosestDistancesSq[i])
+			{
+				for (int32 j = 2; j > i; --j)
+				{
+					ClosestAllies[j] = ClosestAllies[j - 1];
+					ClosestDistancesSq[j] = ClosestDistancesSq[j - 1];
+				}
+				ClosestAllies[i] = &Ally;
+				ClosestDistancesSq[i] = DistanceSq;
+				break;
+			}
+		}
+	}
+
+	for (int32 i = 0; i < 3 && ClosestAllies[i]; ++i)
+	{
+		FEliteRewardAlly& RewardAlly = OutClosestAllies.AddDefaulted_GetRef();
+		RewardAlly.DistanceToSelf = FMath::Sqrt(ClosestDistancesSq[i]);
+		RewardAlly.DistanceToPlayer = FVector::Dist(CachedPlayerLocation, ClosestAllies[i]->Location);
+		RewardAlly.RoleFlags = ClosestAllies[i]->RoleFlags;
+	}
 
 	const float MaxAllyDistance = 2000.0f;
 
-	if (ClosestAllies.Num() > 0 && ClosestAllies[0] && ClosestAllies[0]->IsValidLowLevel())
+	if (ClosestAllies[0])
 	{
-		State.HealthOfClosestAlly = GetCharacterHealthPercentage(ClosestAllies[0]);
-		State.DistanceToClosestAlly = FMath::Clamp(
-			FVector::Dist(OwnerCharacter->GetActorLocation(), ClosestAllies[0]->GetActorLocation()) / MaxAllyDistance,
-			0.0f, 1.0f
-		);
+		State.HealthOfClosestAlly = ClosestAllies[0]->HealthPercentage;
+		State.DistanceToClosestAlly = FMath::Clamp(FMath::Sqrt(ClosestDistancesSq[0]) / MaxAllyDistance, 0.0f, 1.0f);
 	}
 
-	if (ClosestAllies.Num() > 1 && ClosestAllies[1] && ClosestAllies[1]->IsValidLowLevel())
+	if (ClosestAllies[1])
 	{
-		State.HealthOfSecondClosestAlly = GetCharacterHealthPercentage(ClosestAllies[1]);
-		State.DistanceToSecondClosestAlly = FMath::Clamp(
-			FVector::Dist(OwnerCharacter->GetActorLocation(), ClosestAllies[1]->GetActorLocation()) / MaxAllyDistance,
-			0.0f, 1.0f
-		);
+		State.HealthOfSecondClosestAlly = ClosestAllies[1]->HealthPercentage;
+		State.DistanceToSecondClosestAlly = FMath::Clamp(FMath::Sqrt(ClosestDistancesSq[1]) / MaxAllyDistance, 0.0f, 1.0f);
 	}
 
-	if (ClosestAllies.Num() > 2 && ClosestAllies[2] && ClosestAllies[2]->IsValidLowLevel())
+	if (ClosestAllies[2])
 	{
-		State.HealthOfThirdClosestAlly = GetCharacterHealthPercentage(ClosestAllies[2]);
-		State.DistanceToThirdClosestAlly = FMath::Clamp(
-			FVector::Dist(OwnerCharacter->GetActorLocation(), ClosestAllies[2]->GetActorLocation()) / MaxAllyDistance,
-			0.0f, 1.0f
-		);
+		State.HealthOfThirdClosestAlly = ClosestAllies[2]->HealthPercentage;
+		State.DistanceToThirdClosestAlly = FMath::Clamp(FMath::Sqrt(ClosestDistancesSq[2]) / MaxAllyDistance, 0.0f, 1.0f);
 	}
 
 	// Team awareness
-	int32 NearbyCount = CountNearbyAllies(1000.0f);
 	State.NumNearbyAllies = FMath::Clamp((float)NearbyCount / 5.0f, 0.0f, 1.0f);
 
 	return State;
@@ -422,6 +616,8 @@ FRLState URLComponent::BuildState()
 
 void URLComponent::ExecuteAction(EEliteAction Action, float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_ExecuteAction);
+
 	if (!OwnerCharacter || !PlayerCharacter)
 		return;
 
@@ -439,7 +635,10 @@ void URLComponent::ExecuteAction(EEliteAction Action, float DeltaTime)
 		MoveComp->bOrientRotationToMovement = true;
 	}
 	// Focus player to force AI to face player
-	AIController->SetFocus(PlayerCharacter);
+	if (AIController->GetFocusActor() != PlayerCharacter)
+	{
+		AIController->SetFocus(PlayerCharacter);
+	}
 
 	FVector OwnerLocation = OwnerCharacter->GetActorLocation();
 	FVector PlayerLocation = CachedPlayerLocation;
@@ -452,25 +651,25 @@ void URLComponent::ExecuteAction(EEliteAction Action, float DeltaTime)
 	{
 	case EEliteAction::Move_Towards_Player:
 	{
-		AIController->MoveToActor(PlayerCharacter, 75.0f);
+		MoveCommander.MoveToActor(AIController, Action, PlayerCharacter, 75.0f);
 		break;
 	}
 	case EEliteAction::Move_Away_From_Player:
 	{
 		FVector TargetLocation = OwnerLocation - DirectionToPlayer * MoveOffset;
-		AIController->MoveToLocation(TargetLocation, 50.0f);
+		MoveCommander.MoveToLocation(AIController, Action, PlayerLocation, TargetLocation, 50.0f);
 		break;
 	}
 	case EEliteAction::Strafe_Left:
 	{
 		FVector TargetLocation = OwnerLocation - RightVector * MoveOffset;
-		AIController->MoveToLocation(TargetLocation, 50.0f);
+		MoveCommander.MoveToLocation(AIController, Action, PlayerLocation, TargetLocation, 50.0f);
 		break;
 	}
 	case EEliteAction::Strafe_Right:
 	{
 		FVector TargetLocation = OwnerLocation + RightVector * MoveOffset;
-		AIController->MoveToLocation(TargetLocation, 50.0f);
+		MoveCommander.MoveToLocation(AIController, Action, PlayerLocation, TargetLocation, 50.0f);
 		break;
 	}
 	case EEliteAction::Primary_Attack:
@@ -499,59 +698,30 @@ void URLComponent::ExecuteAction(EEliteAction Action, float DeltaTime)
 
 void URLComponent::RecordDamageDealt(float Damage)
 {
-	float CurrentTime = GetWorld()->GetTimeSeconds();
-	DamageHistory.Add(TPair<float, float>(CurrentTime, Damage));
+	DamageWindow.Add(GetWorld()->GetTimeSeconds(), Damage);
 }
 
 void URLComponent::RecordHealingDone(float HealAmount)
 {
-	float CurrentTime = GetWorld()->GetTimeSeconds();
-	HealingHistory.Add(TPair<float, float>(CurrentTime, HealAmount));
+	HealingWindow.Add(GetWorld()->GetTimeSeconds(), HealAmount);
 }
 
 float URLComponent::GetAverageDPS() const
 {
-	if (DamageHistory.Num() == 0)
-		return 0.0f;
-
-	float TotalDamage = 0.0f;
-	for (const auto& Record : DamageHistory)
-	{
-		TotalDamage += Record.Value;
-	}
-
-	// Return average DPS over last 5 seconds
-	return TotalDamage / 5.0f;
+	// Average DPS over last 5 seconds
+	return DamageWindow.GetRate();
 }
 
 float URLComponent::GetAverageHPS() const
 {
-	if (HealingHistory.Num() == 0)
-		return 0.0f;
-
-	float TotalHealing = 0.0f;
-	for (const auto& Record : HealingHistory)
-	{
-		TotalHealing += Record.Value;
-	}
-
-	// Return average HPS over last 5 seconds
-	return TotalHealing / 5.0f;
+	// Average HPS over last 5 seconds
+	return HealingWindow.GetRate();
 }
 
 void URLComponent::CleanupDamageHistory(float CurrentTime)
 {
-	const float TimeWindow = 5.0f; // Keep last 5 seconds of data (changed from 1.0)
-
-	// Clean damage history
-	DamageHistory.RemoveAll([CurrentTime, TimeWindow](const TPair<float, float>& Record) {
-		return (CurrentTime - Record.Key) > TimeWindow;
-	});
-
-	// Clean healing history
-	HealingHistory.RemoveAll([CurrentTime, TimeWindow](const TPair<float, float>& Record) {
-		return (CurrentTime - Record.Key) > TimeWindow;
-	});
+	DamageWindow.Advance(CurrentTime);
+	HealingWindow.Advance(CurrentTime);
 }
 
 bool URLComponent::CanAttack() const
@@ -564,25 +734,38 @@ bool URLComponent::JustAttacked() const
 	return TimeSinceLastPrimaryAttack < 1.5f;
 }
 
-void URLComponent::UpdatePoisons(float DeltaTime)
+int32 URLComponent::GetNumActivePoisons() const
 {
-	// Base implementation does nothing - overridden by AssassinRLComponent
+	const UEliteStatusEffectManager* StatusEffects = UEliteStatusEffectManager::Get(GetWorld());
+	return StatusEffects ? StatusEffects->GetActiveCount(this, EEliteStatusEffect::Poison) : 0;
 }
 
-bool URLComponent::HasActivePoisonOnPlayer() const
+FEliteRewardFunction URLComponent::GetRewardFunction() const
 {
-	return ActivePoisons.Num() > 0;
+	return &EliteRewards::None;
 }
 
-float URLComponent::CalculateReward()
+const FEliteRewardProgram* URLComponent::GetRewardProgram() const
 {
-	// Base reward is 0. Override in subclasses.
-	return 0.0f;
+	return Archetype && Archetype->RewardProgram && !Archetype->RewardProgram->IsEmpty() ? Archetype->RewardProgram.Get() : nullptr;
+}
+
+float URLComponent::EvaluateReward(FEliteRewardBreakdown* OutBreakdown) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_EvaluateReward);
+
+	if (const FEliteRewardProgram* Program = GetRewardProgram())
+	{
+		return Program->EvaluateOne(RewardContext, OutBreakdown);
+	}
+	return GetRewardFunction()(RewardContext, OutBreakdown);
 }
 
 
 void URLComponent::FindClosestAllies(TArray<ACharacter*>& OutAllies, int32 NumAllies)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_FindClosestAllies);
+
 	OutAllies.Empty();
 
 	if (!OwnerCharacter || !OwnerCharacter->IsValidLowLevel())
@@ -625,9 +808,18 @@ void URLComponent::FindClosestAllies(TArray<ACharacter*>& OutAllies, int32 NumAl
 
 bool URLComponent::HasLineOfSightToPlayer()
 {
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_LineOfSight);
+
 	if (!OwnerCharacter || !PlayerCharacter)
 		return false;
 
+	// Budgeted and cached across all elites
+	if (UEliteTraceScheduler* TraceScheduler = UEliteTraceScheduler::Get(GetWorld()))
+	{
+		return TraceScheduler->QueryLineOfSight(OwnerCharacter, PlayerCharacter, CachedPlayerLocation,
+			UEliteSignificanceManager::GetLineOfSightCacheScale(Significance));
+	}
+
 	FHitResult HitResult;
 	FVector Start = OwnerCharacter->GetActorLocation();
 	FVector End = CachedPlayerLocation;
@@ -640,102 +832,41 @@ bool URLComponent::HasLineOfSightToPlayer()
 	return !bHit || HitResult.GetActor() == PlayerCharacter;
 }
 
-int32 URLComponent::CountNearbyAllies(float Radius)
-{
-	if (!OwnerCharacter || !OwnerCharacter->IsValidLowLevel())
-		return 0;
-
-	TArray<AActor*> FoundActors;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ACharacter::StaticClass(), FoundActors);
-
-	int32 Count = 0;
-	for (AActor* Actor : FoundActors)
-	{
-		ACharacter* Ally = Cast<ACharacter>(Actor);
-		
-		// Add validity checks
-		if (Ally && Ally->IsValidLowLevel() && !Ally->IsPendingKillOrUnreachable() && 
-			Ally != OwnerCharacter && IsCharacterAlive(Ally))
-		{
-			// Check if this character has an AI controller (is an elite)
-			AAIController* AllyAI = Cast<AAIController>(Ally->GetController());
-			if (AllyAI)
-			{
-				float Distance = FVector::Dist(OwnerCharacter->GetActorLocation(), Ally->GetActorLocation());
-				if (Distance <= Radius)
-				{
-					Count++;
-				}
-			}
-		}
-	}
-
-	return Count;
-}
-
 void URLComponent::OnPlayerPositionUpdated(const FVector& NewPlayerPosition)
 {
 	CachedPlayerLocation = NewPlayerPosition;
 }
 
-void URLComponent::DebugDraw()
+void URLComponent::WriteDebugRecord()
 {
-	if (!OwnerCharacter)
+#if ENABLE_DRAW_DEBUG
+	UEliteDebugOverlay* Overlay = UEliteDebugOverlay::Get(GetWorld());
+	if (!OwnerCharacter || !Overlay)
 		return;
 
-	FVector OwnerLocation = OwnerCharacter->GetActorLocation();
-	FVector DebugLocation = OwnerLocation + FVector(0, 0, 150);
-
-	FString StateText = "State: ";
-	switch (AttackState)
-	{
-	case EAttackState::Normal: StateText += "Normal"; break;
-	case EAttackState::Attacking: StateText += "ATTACKING"; break;
-	case EAttackState::OnCooldown: StateText += "Cooldown"; break;
-	}
-
-	// Show distance and recent reward
-	FString DebugText = FString::Printf(
-		TEXT("%s\nAction: %d\nR: %.2f\nDist: %.2f (%.0f/%0.f)\nHP: %.2f\nDPS: %.1f\nEps: %.2f"),
-		*StateText,
-		static_cast<int32>(LastAction),
-		LastReward,
-		CurrentState.DistanceToPlayer,
-		ActualDistanceToPlayer,
-		MaxAttackRange,
-		CurrentState.SelfHealthPercentage,
-		GetAverageDPS(),
-		Epsilon
-	);
-
-	DrawDebugString(GetWorld(), DebugLocation, DebugText, nullptr, FColor::Yellow, 0.1f, true);
+	FEliteDebugRecord Record;
+	Record.Location = OwnerCharacter->GetActorLocation();
+	Record.EliteId = OwnerCharacter->GetUniqueID();
+	Record.Time = GetWorld()->GetTimeSeconds();
+	Record.Reward = LastReward;
+	Record.NormalizedDistance = CurrentState.DistanceToPlayer;
+	Record.DistanceToPlayer = ActualDistanceToPlayer;
+	Record.MaxAttackRange = MaxAttackRange;
+	Record.HealthPercentage = CurrentState.SelfHealthPercentage;
+	Record.DPS = GetAverageDPS();
+	Record.Epsilon = Epsilon;
+	Record.EliteType = static_cast<uint8>(EliteType);
+	Record.Action = static_cast<uint8>(LastAction);
+	Record.AttackState = static_cast<uint8>(AttackState);
+	Record.Significance = static_cast<uint8>(Significance);
+
+	Overlay->Write(Record);
+#endif
 }
 
 float URLComponent::GetCharacterHealthPercentage(ACharacter* Character) const
 {
-	if (!Character || !Character->IsValidLowLevel() || Character->IsPendingKillOrUnreachable())
-		return 0.0f;
-
-	// Try to get CurrentHealth and MaxHealth from Blueprint
-	UClass* CharClass = Character->GetClass();
-	if (!CharClass || !CharClass->IsValidLowLevel())
-		return 0.0f;
-
-	FProperty* CurrentHealthProp = CharClass->FindPropertyByName(TEXT("CurrentHealth"));
-	FProperty* MaxHealthProp = CharClass->FindPropertyByName(TEXT("MaxHealth"));
-
-	if (CurrentHealthProp && MaxHealthProp)
-	{
-		float* CurrentHealthPtr = CurrentHealthProp->ContainerPtrToValuePtr<float>(Character);
-		float* MaxHealthPtr = MaxHealthProp->ContainerPtrToValuePtr<float>(Character);
-
-		if (CurrentHealthPtr && MaxHealthPtr && *MaxHealthPtr > 0.0f)
-		{
-			return FMath::Clamp(*CurrentHealthPtr / *MaxHealthPtr, 0.0f, 1.0f);
-		}
-	}
-
-	return 1.0f; // Default assumption
+	return FEliteWorldSnapshot::ReadHealthPercentage(Character);
 }
 
 bool URLComponent::IsCharacterAlive(ACharacter* Character) const
@@ -750,7 +881,7 @@ void URLComponent::PerformPrimaryAttackOnElite()
 {
 	if (!EliteBehavior || !OwnerCharacter)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("RLComponent: Cannot perform attack - EliteBehavior or OwnerCharacter is null!"));
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("RLComponent: Cannot perform attack - EliteBehavior or OwnerCharacter is null!"));
 		return;
 	}
 
@@ -766,8 +897,7 @@ void URLComponent::PerformPrimaryAttackOnElite()
 	
 	if (DistanceToPlayer > MaxAttackRange)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("%s: Attack cancelled! Player out of range (%.1f/%.1f)"), 
-			*OwnerCharacter->GetName(), DistanceToPlayer, MaxAttackRange);
+		SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeAI, Log, "Elite attacks cancelled (player out of range)", 0.0f);
 		return;
 	}
 
@@ -775,8 +905,7 @@ void URLComponent::PerformPrimaryAttackOnElite()
 	AttackWindupStartPlayerLocation = Player->GetActorLocation();
 	
 	// Set attack state (after range check passed)
-	AttackState = EAttackState::Attacking;
-	AttackTimer = 0.0f;
+	StartAttackWindup();
 	
 	// Trigger Blueprint custom event "OnAttackStart" with WindupDuration parameter
 	UFunction* AttackStartFunc = OwnerCharacter->FindFunction(FName("OnAttackStart"));
@@ -793,8 +922,7 @@ void URLComponent::PerformPrimaryAttackOnElite()
 		OwnerCharacter->ProcessEvent(AttackStartFunc, &Params);
 	}
 	
-	UE_LOG(LogTemp, Log, TEXT("%s: Starting attack windup (%.2fs)..."), 
-		*OwnerCharacter->GetName(), AttackWindupDuration);
+	SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeAI, Log, "Elite attack windups started", 0.0f);
 }
 
 void URLComponent::PerformSecondaryAttackOnElite()
@@ -803,7 +931,7 @@ void URLComponent::PerformSecondaryAttackOnElite()
 		return;
 
 	// For now, only Healer has secondary attack (heal)
-	if (EliteBehavior && EliteBehavior->IsA(AEliteHealer::StaticClass()))
+	if (Archetype && Archetype->HasRole(EEliteRoleFlags::Healer))
 	{
 		// Read HealAmount from Blueprint
 		FProperty* HealAmountProp = OwnerCharacter->GetClass()->FindPropertyByName(TEXT("HealAmount"));
@@ -844,8 +972,7 @@ void URLComponent::PerformSecondaryAttackOnElite()
 		if (BestTarget)
 		{
 			// Set attack state (before triggering animation)
-			AttackState = EAttackState::Attacking;
-			AttackTimer = 0.0f;
+			StartAttackWindup();
 			
 			// Trigger Blueprint custom event "OnSecondaryStart" with WindupDuration parameter
 			UFunction* SecondaryStartFunc = OwnerCharacter->FindFunction(FName("OnSecondaryStart"));
@@ -876,52 +1003,77 @@ void URLComponent::PerformSecondaryAttackOnElite()
 			}
 			
 			RecordHealingDone(HealAmount);
-			UE_LOG(LogTemp, Log, TEXT("Healer: Healed %s for %.0f HP"), *BestTarget->GetName(), HealAmount);
+			if (UEliteCombatEventBus* CombatEvents = UEliteCombatEventBus::Get(GetWorld()))
+			{
+				CombatEvents->PushHeal(BestTarget, HealAmount, OwnerCharacter);
+			}
+			SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeAI, Log, "Healer heals", HealAmount);
 		}
 	}
 	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("%s: Secondary attack (not implemented for this elite type)"), 
-			*OwnerCharacter->GetName());
+		SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeAI, Verbose, "Secondary attacks without an implementation", 0.0f);
 	}
 }
 
-void URLComponent::OnAttackWindupComplete()
+void URLComponent::StartAttackWindup()
 {
-	if (!EliteBehavior || !OwnerCharacter)
+	AttackState = EAttackState::Attacking;
+	AttackTimer = 0.0f;
+
+	UEliteCombatTimeline* Timeline = UEliteCombatTimeline::Get(GetWorld());
+	if (!Timeline)
+	{
+		// No timeline outside game worlds - resolve on the spot so we never stay stuck winding up
+		FAttackWindupResult Result;
+		Result.Player = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
+		if (Result.Player)
+		{
+			Result.DistanceToPlayer = FVector::Dist(OwnerCharacter->GetActorLocation(), Result.Player->GetActorLocation());
+			Result.bInRange = Result.DistanceToPlayer <= MaxAttackRange;
+		}
+		OnAttackWindupResolved(Result);
 		return;
+	}
 
-	UWorld* World = OwnerCharacter->GetWorld();
-	if (!World)
+	Timeline->ScheduleWindup(OwnerCharacter, AttackWindupDuration, MaxAttackRange,
+		FOnAttackWindupResolved::CreateUObject(this, &URLComponent::OnAttackWindupResolved));
+}
+
+void URLComponent::OnAttackWindupResolved(const FAttackWindupResult& Result)
+{
+	if (AttackState != EAttackState::Attacking)
 		return;
 
-	ACharacter* Player = UGameplayStatics::GetPlayerCharacter(World, 0);
-	if (!Player)
+	// Attack windup finished - apply damage if the player is still in range
+	OnAttackWindupComplete(Result);
+
+	// Enter cooldown
+	AttackState = EAttackState::OnCooldown;
+	AttackTimer = 0.0f;
+}
+
+void URLComponent::OnAttackWindupComplete(const FAttackWindupResult& Result)
+{
+	if (!EliteBehavior || !OwnerCharacter || !Result.Player)
 		return;
 
 	// Check if player is STILL in range after windup
-	float CurrentDistanceToPlayer = FVector::Dist(OwnerCharacter->GetActorLocation(), Player->GetActorLocation());
-	
-	if (CurrentDistanceToPlayer > MaxAttackRange)
+	if (!Result.bInRange)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("%s: Attack missed! Player dodged out of range during windup (%.1f/%.1f)"), 
-			*OwnerCharacter->GetName(), CurrentDistanceToPlayer, MaxAttackRange);
+		SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeAI, Log, "Elite attacks missed (player dodged)", 0.0f);
 		return;
 	}
 
 	// Player is still in range - apply damage!
-	UE_LOG(LogTemp, Log, TEXT("%s: Attack hit! (%.0f damage)"), *OwnerCharacter->GetName(), AttackDamage);
+	SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeAI, Log, "Elite attack hits", AttackDamage);
 
 	// Record damage
 	RecordDamageDealt(AttackDamage);
 
-	// Report damage to Enemy Logic Manager
-	AEnemyLogicManager* EnemyLogicMgr = Cast<AEnemyLogicManager>(
-		UGameplayStatics::GetActorOfClass(World, AEnemyLogicManager::StaticClass())
-	);
-
-	if (EnemyLogicMgr && Player)
+	// Report damage to Enemy Logic Manager (delivered with the frame's other hits)
+	if (UEliteCombatEventBus* CombatEvents = UEliteCombatEventBus::Get(GetWorld()))
 	{
-		EnemyLogicMgr->ReportDamageToPlayer(Player, AttackDamage, OwnerCharacter);
+		CombatEvents->PushDamage(Result.Player, AttackDamage, OwnerCharacter);
 	}
 }
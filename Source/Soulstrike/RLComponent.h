@@ -2,131 +2,21 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Util/SlidingWindowSum.h"
+#include "RLTypes.h"
+#include "EliteMoveCommander.h"
 #include "RLComponent.generated.h"
 
 // Forward declarations
 class AEliteEnemy;
 class ACharacter;
 class FQLearningBrain;
+struct FEliteArchetype;
+struct FEliteWorldSnapshot;
+class FEliteRewardProgram;
+struct FAttackWindupResult;
 enum class EEliteType : uint8;
-
-/** Poison damage-over-time effect (for Assassin) */
-USTRUCT()
-struct FPoisonEffect
-{
-	GENERATED_BODY()
-
-	float RemainingDuration;
-	float DamagePerTick;
-	float TickInterval;
-	float TimeSinceLastTick;
-
-	FPoisonEffect()
-		: RemainingDuration(0.0f)
-		, DamagePerTick(0.0f)
-		, TickInterval(0.5f)
-		, TimeSinceLastTick(0.0f)
-	{}
-};
-
-/**
- * Attack State Enumeration
- */
-UENUM(BlueprintType)
-enum class EAttackState : uint8
-{
-	Normal UMETA(DisplayName = "Normal"),
-	Attacking UMETA(DisplayName = "Attacking"),
-	OnCooldown UMETA(DisplayName = "On Cooldown")
-};
-
-/**
- * Elite Action Enumeration
- */
-UENUM(BlueprintType)
-enum class EEliteAction : uint8
-{
-	Move_Towards_Player UMETA(DisplayName = "Move Towards Player"),
-	Move_Away_From_Player UMETA(DisplayName = "Move Away From Player"),
-	Strafe_Left UMETA(DisplayName = "Strafe Left"),
-	Strafe_Right UMETA(DisplayName = "Strafe Right"),
-	Primary_Attack UMETA(DisplayName = "Primary Attack"),
-	Secondary_Attack UMETA(DisplayName = "Secondary Attack")
-};
-
-/**
- * Reinforcement Learning State Structure
- * All values normalized to [0,1] unless otherwise specified
- */
-USTRUCT(BlueprintType)
-struct FRLState
-{
-	GENERATED_BODY()
-
-	// Self
-	UPROPERTY(BlueprintReadOnly)
-	float DistanceToPlayer; // Normalized by MaxAttackRange, clamped [0,1]
-
-	UPROPERTY(BlueprintReadOnly)
-	float SelfHealthPercentage; // [0,1]
-
-	UPROPERTY(BlueprintReadOnly)
-	float TimeSinceLastAttack; // Normalized by max time (5 seconds)
-
-	UPROPERTY(BlueprintReadOnly)
-	bool bIsBeyondMaxRange; // True if actual distance > MaxAttackRange
-
-	UPROPERTY(BlueprintReadOnly)
-	bool bTookDamageRecently; // True if damaged in last 1.0s (proxy for "player attacking")
-
-	// Player
-	UPROPERTY(BlueprintReadOnly)
-	float PlayerHealthPercentage; // [0,1]
-
-	UPROPERTY(BlueprintReadOnly)
-	bool bHasLineOfSightToPlayer; // True if unobstructed
-
-	// Allies (closest 3)
-	UPROPERTY(BlueprintReadOnly)
-	float HealthOfClosestAlly; // [0,1]
-
-	UPROPERTY(BlueprintReadOnly)
-	float DistanceToClosestAlly; // Normalized by 2000 units
-
-	UPROPERTY(BlueprintReadOnly)
-	float HealthOfSecondClosestAlly;
-
-	UPROPERTY(BlueprintReadOnly)
-	float DistanceToSecondClosestAlly;
-
-	UPROPERTY(BlueprintReadOnly)
-	float HealthOfThirdClosestAlly;
-
-	UPROPERTY(BlueprintReadOnly)
-	float DistanceToThirdClosestAlly;
-
-	// Team awareness
-	UPROPERTY(BlueprintReadOnly)
-	float NumNearbyAllies; // Count within 1000 units, normalized by max team size (5)
-
-	FRLState()
-		: DistanceToPlayer(0.0f)
-		, SelfHealthPercentage(1.0f)
-		, TimeSinceLastAttack(0.0f)
-		, bIsBeyondMaxRange(false)
-		, bTookDamageRecently(false)
-		, PlayerHealthPercentage(1.0f)
-		, bHasLineOfSightToPlayer(true)
-		, HealthOfClosestAlly(0.0f)
-		, DistanceToClosestAlly(1.0f)
-		, HealthOfSecondClosestAlly(0.0f)
-		, DistanceToSecondClosestAlly(1.0f)
-		, HealthOfThirdClosestAlly(0.0f)
-		, DistanceToThirdClosestAlly(1.0f)
-		, NumNearbyAllies(0.0f)
-	{
-	}
-};
+enum class EEliteSignificance : uint8;
 
 /**
  * Base Reinforcement Learning Component for Elite Enemies
@@ -147,12 +37,44 @@ protected:
 public:
 	// ========== INITIALIZATION ==========
 	
-	/** Initialize the RL component with the owning pawn */
-	void Initialize(APawn* InPawn);
+	/** Initialize the RL component with the owning pawn and its resolved archetype */
+	void Initialize(APawn* InPawn, const FEliteArchetype& InArchetype);
 
-	/** Main RL execution step called by the AI controller */
+	/** Full RL step for this elite alone (all phases below, with its own world snapshot) */
 	void ExecuteRLStep(float DeltaTime);
 
+	// ========== PHASED STEPPING (driven by UEliteRLScheduler) ==========
+
+	/**
+	 * Phase 1 (game thread): advance timers and the attack state machine, and read what the state
+	 * needs from our own actor. Returns false when no decision is made this step (dead or winding up).
+	 */
+	bool BeginRLStep(float DeltaTime);
+
+	/** Phase 2 (any thread): build the current state and reward context from the frame's world snapshot */
+	void BuildStateFromSnapshot(const FEliteWorldSnapshot& Snapshot);
+
+	/**
+	 * Reward program the scheduler should evaluate this step's reward with (batched across elites),
+	 * or null when RunInference evaluates it itself - not learning, no reward terms, or debugging.
+	 */
+	const FEliteRewardProgram* GetBatchedRewardProgram() const;
+
+	/** Reward inputs captured in phase 2 */
+	const FEliteRewardContext& GetRewardContext() const { return RewardContext; }
+
+	/** Hand in the batched reward for this step (between phases 2 and 3) */
+	void SetStepReward(float Reward);
+
+	/** Phase 3 (any thread): reward the last transition, learn from it and select the next action */
+	void RunInference();
+
+	/** Phase 4 (game thread): apply the selected action to the world */
+	void ApplyRLStep();
+
+	/** Set the significance tier (decides learning and LOS cache lifetime) */
+	void SetSignificance(EEliteSignificance InSignificance) { Significance = InSignificance; }
+
 	// ========== RL HYPERPARAMETERS ==========
 
 	/** Learning rate (alpha) */
@@ -212,9 +134,40 @@ protected:
 	/** Elite type for weight persistence */
 	EEliteType EliteType;
 
+	/** Copy of the archetype resolved at spawn (the registry's array may reallocate on edit) */
+	TSharedPtr<const FEliteArchetype> Archetype;
+
+	/** Significance tier assigned by the AI controller */
+	EEliteSignificance Significance;
+
+	// ========== STEP SCRATCH (written by one phase, read by the next) ==========
+
+	float StepDeltaTime;
+	FVector StepOwnerLocation;
+	float StepHealthPercentage;
+	bool bStepLineOfSight;
+	bool bStepLearns;
+	bool bStepRecords;
+	bool bStepRewardReady;
+	bool bStepDecides;
+	int32 StepActivePoisons;
+	EEliteAction StepSelectedAction;
+
+	/** Reward inputs captured while building the state */
+	FEliteRewardContext RewardContext;
+
+	/** Reward terms of the last step (only filled in debug mode) */
+	FEliteRewardBreakdown RewardBreakdown;
+
 	/** Q-Learning brain (handles all Q-value calculations) */
 	TSharedPtr<FQLearningBrain> Brain;
 
+	/** Weights the brain started from; with simulation worlds running only what was learned since is merged back */
+	TMap<EEliteAction, TMap<FName, float>> SpawnWeights;
+
+	/** Issues path requests only when the movement actually changes */
+	FEliteMoveCommander MoveCommander;
+
 public:
 	// ========== ELITE STATS (accessible from AI controller) ==========
 
@@ -250,11 +203,11 @@ protected:
 	/** Health at previous tick (to detect damage) */
 	float PreviousHealth;
 
-	/** Damage dealt history (last 5 seconds) - for DPS calculation */
-	TArray<TPair<float, float>> DamageHistory; // (Time, Damage)
+	/** Damage dealt over the last 5 seconds (0.1s buckets) - for DPS calculation */
+	TSlidingWindowSum<50> DamageWindow{ 5.0f };
 
-	/** Healing done history (last 5 seconds) - for healer HPS calculation */
-	TArray<TPair<float, float>> HealingHistory; // (Time, HealAmount)
+	/** Healing done over the last 5 seconds (0.1s buckets) - for healer HPS calculation */
+	TSlidingWindowSum<50> HealingWindow{ 5.0f };
 
 	/** Current action persistence counter */
 	float ActionPersistenceTimer;
@@ -262,6 +215,26 @@ protected:
 	/** Last selected action before persistence check */
 	EEliteAction PendingAction;
 
+	// ========== DECISIONS (semi-MDP) ==========
+
+	/** Whether to choose a new action this step or keep acting on the last decision */
+	bool ShouldDecide() const;
+
+	/** State and attack state the last decision was made in; steps until the next one repeat LastAction */
+	FRLState DecisionState;
+	EAttackState DecisionAttackState;
+	bool bHasDecision;
+
+	/** Time the current decision has been held */
+	float DecisionHoldTime;
+
+	/** Discounted reward collected since the last decision and the number of steps it spans */
+	float DecisionReward;
+	int32 DecisionSteps;
+
+	/** False once a step since the last decision did not learn (its return is incomplete) */
+	bool bDecisionLearns;
+
 	// ========== STATS POLLING ==========
 	
 	/** Timer for periodic stat polling (separate from other timers) */
@@ -278,7 +251,7 @@ protected:
 	/** Current attack state */
 	EAttackState AttackState;
 
-	/** Timer for attack duration and cooldown */
+	/** Timer for the attack cooldown (windups are timed by UEliteCombatTimeline) */
 	float AttackTimer;
 
 	/** Cached player location when attack windup started (to check range on completion) */
@@ -300,15 +273,12 @@ protected:
 	float PreviousDistanceToPlayer;
 
 	// ========== POISON TRACKING (for Assassin) ==========
-	
-	/** Active poison effects (for Assassin elite type) */
-	TArray<FPoisonEffect> ActivePoisons;
 
-	/** Update poison ticks (called every frame for Assassin) - VIRTUAL for override */
-	virtual void UpdatePoisons(float DeltaTime);
+	/** Poisons this elite has running on the player (ticked by UEliteStatusEffectManager) */
+	int32 GetNumActivePoisons() const;
 
 	/** Check if poison is active on player (for Assassin reward logic) */
-	bool HasActivePoisonOnPlayer() const;
+	bool HasActivePoisonOnPlayer() const { return GetNumActivePoisons() > 0; }
 
 public:
 	/** Record damage dealt to player */
@@ -337,34 +307,37 @@ public:
 	float MinActionDuration;
 
 protected:
-	/** Clean up old damage/healing records */
+	/** Expire damage/healing that fell out of the DPS/HPS window */
 	void CleanupDamageHistory(float CurrentTime);
 
 	// ========== CORE RL METHODS ==========
 
-	/** Build the current state from world data */
-	FRLState BuildState();
+	/** Build the current state from the world snapshot (no actor access), collecting the closest allies for the reward */
+	FRLState BuildState(const FEliteWorldSnapshot& Snapshot, TArray<FEliteRewardAlly, TInlineAllocator<3>>& OutClosestAllies);
 
 	/** Execute the chosen action in the world */
 	void ExecuteAction(EEliteAction Action, float DeltaTime);
 
-	/** Calculate the reward for the current state (VIRTUAL - override in subclasses) */
-	virtual float CalculateReward();
+	/** Pure reward function for this elite type (VIRTUAL - override in subclasses) */
+	virtual FEliteRewardFunction GetRewardFunction() const;
+
+	/** Compiled reward terms of our archetype (null when it has none) */
+	const FEliteRewardProgram* GetRewardProgram() const;
+
+	/** Reward the last transition from the archetype's terms, or the reward function when there are none */
+	float EvaluateReward(FEliteRewardBreakdown* OutBreakdown) const;
 
 	// ========== HELPER METHODS ==========
 
 	/** Check if this elite has line of sight to the player */
 	bool HasLineOfSightToPlayer();
 
-	/** Count nearby allies within a radius */
-	int32 CountNearbyAllies(float Radius = 1000.0f);
-
 	/** Callback when player position is updated */
 	UFUNCTION()
 	void OnPlayerPositionUpdated(const FVector& NewPlayerPosition);
 
-	/** Debug visualization */
-	void DebugDraw();
+	/** Hand this step's debug readout to the debug overlay */
+	void WriteDebugRecord();
 
 	/** Get health percentage from Blueprint variables */
 	float GetCharacterHealthPercentage(ACharacter* Character) const;
@@ -376,6 +349,12 @@ protected:
 	void PerformPrimaryAttackOnElite();
 	virtual void PerformSecondaryAttackOnElite();
 
+	/** Enter the Attacking state and schedule the windup's resolution on the combat timeline */
+	void StartAttackWindup();
+
+	/** Combat timeline callback - finishes the windup and enters cooldown */
+	void OnAttackWindupResolved(const FAttackWindupResult& Result);
+
 	/** Called when attack windup completes - applies damage if player still in range - VIRTUAL for override */
-	virtual void OnAttackWindupComplete();
+	virtual void OnAttackWindupComplete(const FAttackWindupResult& Result);
 };
@@ -0,0 +1,202 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RLTypes.generated.h"
+
+/**
+ * Attack State Enumeration
+ */
+UENUM(BlueprintType)
+enum class EAttackState : uint8
+{
+	Normal UMETA(DisplayName = "Normal"),
+	Attacking UMETA(DisplayName = "Attacking"),
+	OnCooldown UMETA(DisplayName = "On Cooldown")
+};
+
+/**
+ * Elite Action Enumeration
+ */
+UENUM(BlueprintType)
+enum class EEliteAction : uint8
+{
+	Move_Towards_Player UMETA(DisplayName = "Move Towards Player"),
+	Move_Away_From_Player UMETA(DisplayName = "Move Away From Player"),
+	Strafe_Left UMETA(DisplayName = "Strafe Left"),
+	Strafe_Right UMETA(DisplayName = "Strafe Right"),
+	Primary_Attack UMETA(DisplayName = "Primary Attack"),
+	Secondary_Attack UMETA(DisplayName = "Secondary Attack")
+};
+
+/**
+ * Reinforcement Learning State Structure
+ * All values normalized to [0,1] unless otherwise specified
+ */
+USTRUCT(BlueprintType)
+struct FRLState
+{
+	GENERATED_BODY()
+
+	// Self
+	UPROPERTY(BlueprintReadOnly)
+	float DistanceToPlayer; // Normalized by MaxAttackRange, clamped [0,1]
+
+	UPROPERTY(BlueprintReadOnly)
+	float SelfHealthPercentage; // [0,1]
+
+	UPROPERTY(BlueprintReadOnly)
+	float TimeSinceLastAttack; // Normalized by max time (5 seconds)
+
+	UPROPERTY(BlueprintReadOnly)
+	bool bIsBeyondMaxRange; // True if actual distance > MaxAttackRange
+
+	UPROPERTY(BlueprintReadOnly)
+	bool bTookDamageRecently; // True if damaged in last 1.0s (proxy for "player attacking")
+
+	// Player
+	UPROPERTY(BlueprintReadOnly)
+	float PlayerHealthPercentage; // [0,1]
+
+	UPROPERTY(BlueprintReadOnly)
+	bool bHasLineOfSightToPlayer; // True if unobstructed
+
+	// Allies (closest 3)
+	UPROPERTY(BlueprintReadOnly)
+	float HealthOfClosestAlly; // [0,1]
+
+	UPROPERTY(BlueprintReadOnly)
+	float DistanceToClosestAlly; // Normalized by 2000 units
+
+	UPROPERTY(BlueprintReadOnly)
+	float HealthOfSecondClosestAlly;
+
+	UPROPERTY(BlueprintReadOnly)
+	float DistanceToSecondClosestAlly;
+
+	UPROPERTY(BlueprintReadOnly)
+	float HealthOfThirdClosestAlly;
+
+	UPROPERTY(BlueprintReadOnly)
+	float DistanceToThirdClosestAlly;
+
+	// Team awareness
+	UPROPERTY(BlueprintReadOnly)
+	float NumNearbyAllies; // Count within 1000 units, normalized by max team size (5)
+
+	FRLState()
+		: DistanceToPlayer(0.0f)
+		, SelfHealthPercentage(1.0f)
+		, TimeSinceLastAttack(0.0f)
+		, bIsBeyondMaxRange(false)
+		, bTookDamageRecently(false)
+		, PlayerHealthPercentage(1.0f)
+		, bHasLineOfSightToPlayer(true)
+		, HealthOfClosestAlly(0.0f)
+		, DistanceToClosestAlly(1.0f)
+		, HealthOfSecondClosestAlly(0.0f)
+		, DistanceToSecondClosestAlly(1.0f)
+		, HealthOfThirdClosestAlly(0.0f)
+		, DistanceToThirdClosestAlly(1.0f)
+		, NumNearbyAllies(0.0f)
+	{
+	}
+
+	/** Largest change of any feature against Other (1 when a flag flipped) */
+	float GetMaxDifference(const FRLState& Other) const
+	{
+		if (bIsBeyondMaxRange != Other.bIsBeyondMaxRange
+			|| bTookDamageRecently != Other.bTookDamageRecently
+			|| bHasLineOfSightToPlayer != Other.bHasLineOfSightToPlayer)
+		{
+			return 1.0f;
+		}
+
+		float MaxDifference = FMath::Abs(DistanceToPlayer - Other.DistanceToPlayer);
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs(SelfHealthPercentage - Other.SelfHealthPercentage));
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs(TimeSinceLastAttack - Other.TimeSinceLastAttack));
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs(PlayerHealthPercentage - Other.PlayerHealthPercentage));
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs(HealthOfClosestAlly - Other.HealthOfClosestAlly));
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs(DistanceToClosestAlly - Other.DistanceToClosestAlly));
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs(HealthOfSecondClosestAlly - Other.HealthOfSecondClosestAlly));
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs(DistanceToSecondClosestAlly - Other.DistanceToSecondClosestAlly));
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs(HealthOfThirdClosestAlly - Other.HealthOfThirdClosestAlly));
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs(DistanceToThirdClosestAlly - Other.DistanceToThirdClosestAlly));
+		MaxDifference = FMath::Max(MaxDifference, FMath::Abs(NumNearbyAllies - Other.NumNearbyAllies));
+		return MaxDifference;
+	}
+};
+
+/**
+ * One of the closest allies as seen by reward evaluation
+ */
+struct FEliteRewardAlly
+{
+	/** Distance from this elite to the ally */
+	float DistanceToSelf = 0.0f;
+
+	/** Distance from the player to the ally */
+	float DistanceToPlayer = 0.0f;
+
+	/** EEliteRoleFlags of the ally (0 for non-elites) */
+	int32 RoleFlags = 0;
+};
+
+/**
+ * Everything an elite's reward depends on, captured once per step.
+ * Reward functions only read this - no actors, no world - so they can run on any thread.
+ */
+struct FEliteRewardContext
+{
+	FRLState CurrentState;
+	FRLState PreviousState;
+
+	/** Action whose outcome is being rewarded */
+	EEliteAction LastAction = EEliteAction::Move_Towards_Player;
+	EAttackState AttackState = EAttackState::Normal;
+
+	float MaxAttackRange = 500.0f;
+
+	/** Actual distance to the player this step (not normalized) */
+	float ActualDistanceToPlayer = 0.0f;
+
+	/** Normalized distance to the player on the previous step */
+	float PreviousDistanceToPlayer = 0.0f;
+
+	float CurrentDPS = 0.0f;
+	float PreviousDPS = 0.0f;
+	float CurrentHPS = 0.0f;
+	float PreviousHPS = 0.0f;
+
+	/** Poison effects this elite has running on the player (Assassin) */
+	int32 NumActivePoisons = 0;
+
+	/** Closest allies, closest first (up to 3) */
+	TArray<FEliteRewardAlly, TInlineAllocator<3>> ClosestAllies;
+
+	/** Change in actual distance to the player since the previous step */
+	float GetDeltaDistance() const { return ActualDistanceToPlayer - PreviousDistanceToPlayer * MaxAttackRange; }
+};
+
+/**
+ * Named reward terms, filled in only when debugging
+ */
+struct FEliteRewardBreakdown
+{
+	TArray<TPair<FName, float>, TInlineAllocator<12>> Terms;
+
+	void Reset() { Terms.Reset(); }
+	void Add(FName Name, float Value) { Terms.Emplace(Name, Value); }
+
+	FString ToString() const
+	{
+		FString Result;
+		for (const TPair<FName, float>& Term : Terms)
+		{
+			Result += FString::Printf(TEXT("%s=%.2f "), *Term.Key.ToString(), Term.Value);
+		}
+		return Result;
+	}
+};
+
+/** Reward function - must read nothing but the context (breakdown may be null) */
+typedef float (*FEliteRewardFunction)(const FEliteRewardContext& Context, FEliteRewardBreakdown* OutBreakdown);
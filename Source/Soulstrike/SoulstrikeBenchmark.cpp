@@ -0,0 +1,417 @@
+#include "SoulstrikeBenchmark.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeStats.h"
+#include "CharacterBase.h"
+#include "Director.h"
+#include "EliteArchetypeRegistry.h"
+#include "SwarmAIController.h"
+#include "Util/LoadBP.h"
+#include "Util/Spawn.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "RenderCore.h"
+
+static FAutoConsoleCommandWithWorldAndArgs GSoulstrikeBenchmarkCommand(
+	TEXT("Soulstrike.AI.Benchmark"),
+	TEXT("Run the AI scale benchmark. Options: BenchElites=5,50,500 BenchSwarm=1000 BenchFrames=1000 BenchWarmup=120 BenchPackSize=10 BenchRadius=4000 BenchAIRate=20 BenchScripted"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&USoulstrikeBenchmark::StartFromConsole));
+
+USoulstrikeBenchmark* USoulstrikeBenchmark::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<USoulstrikeBenchmark>() : nullptr;
+}
+
+void USoulstrikeBenchmark::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("SoulstrikeBenchmark")))
+	{
+		Start(FCommandLine::Get());
+		bQuitWhenDone = true;
+	}
+}
+
+void USoulstrikeBenchmark::Deinitialize()
+{
+	if (IsRunning())
+	{
+		FSoulstrikeStageTimings::SetEnabled(false);
+	}
+
+	SpawnedActors.Empty();
+	GameThreadSamples.Empty();
+	StageSamples.Empty();
+	Results.Empty();
+
+	Super::Deinitialize();
+}
+
+TStatId USoulstrikeBenchmark::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USoulstrikeBenchmark, STATGROUP_Tickables);
+}
+
+void USoulstrikeBenchmark::StartFromConsole(const TArray<FString>& Args, UWorld* World)
+{
+	USoulstrikeBenchmark* Benchmark = Get(World);
+	if (!Benchmark || Benchmark->IsRunning())
+		return;
+
+	// Same form as the command line so both paths parse alike
+	FString Options;
+	for (const FString& Arg : Args)
+	{
+		Options += FString::Printf(TEXT(" -%s"), *Arg);
+	}
+	Benchmark->Start(*Options);
+}
+
+void USoulstrikeBenchmark::Start(const TCHAR* Options)
+{
+	FString EliteCountList = TEXT("5,50,500");
+	FParse::Value(Options, TEXT("BenchElites="), EliteCountList);
+
+	TArray<FString> Tokens;
+	EliteCountList.ParseIntoArray(Tokens, TEXT(","));
+	EliteCounts.Reset();
+	for (const FString& Token : Tokens)
+	{
+		EliteCounts.Add(FMath::Max(0, FCString::Atoi(*Token)));
+	}
+	if (EliteCounts.Num() == 0)
+	{
+		EliteCounts.Add(0);
+	}
+
+	SwarmCount = 1000;
+	FParse::Value(Options, TEXT("BenchSwarm="), SwarmCount);
+	FParse::Value(Options, TEXT("BenchFrames="), MeasureFrames);
+	FParse::Value(Options, TEXT("BenchWarmup="), WarmupFrames);
+	FParse::Value(Options, TEXT("BenchPackSize="), SwarmPackSize);
+	FParse::Value(Options, TEXT("BenchRadius="), SpawnRadius);
+	bScriptedPlayer = FParse::Param(Options, TEXT("BenchScripted"));
+
+	// A fixed AI rate makes runs comparable across machines: AI work per simulated second no longer scales with frame rate
+	IConsoleVariable* FixedRateVar = IConsoleManager::Get().FindConsoleVariable(TEXT("Soulstrike.AI.FixedRate"));
+	float AIRate = 0.0f;
+	if (FParse::Value(Options, TEXT("BenchAIRate="), AIRate) && FixedRateVar)
+	{
+		FixedRateVar->Set(FMath::Max(0.0f, AIRate), ECVF_SetByCode);
+	}
+	AIRate = FixedRateVar ? FixedRateVar->GetFloat() : 0.0f;
+
+	SwarmCount = FMath::Max(0, SwarmCount);
+	MeasureFrames = FMath::Max(1, MeasureFrames);
+	WarmupFrames = FMath::Max(0, WarmupFrames);
+	SwarmPackSize = FMath::Max(1, SwarmPackSize);
+
+	ScenarioIndex = 0;
+	FrameCounter = 0;
+	Results.Reset();
+	Phase = EPhase::WaitingForPlayer;
+
+	FSoulstrikeStageTimings::SetEnabled(true);
+
+	const FString RateText = AIRate > 0.0f ? FString::Printf(TEXT("%g Hz"), AIRate) : FString(TEXT("per-frame"));
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("SoulstrikeBenchmark: %d scenario(s), %d swarm, %d warmup + %d measured frames, %s player, %s AI"),
+		EliteCounts.Num(), SwarmCount, WarmupFrames, MeasureFrames, bScriptedPlayer ? TEXT("scripted") : TEXT("stationary"), *RateText);
+}
+
+void USoulstrikeBenchmark::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	switch (Phase)
+	{
+	case EPhase::Idle:
+		return;
+
+	case EPhase::WaitingForPlayer:
+	{
+		const ACharacter* Player = UGameplayStatics::GetPlayerCharacter(GetWorld(), 0);
+		if (!GetWorld()->HasBegunPlay() || !Player)
+			return;
+
+		// The Director would keep adding enemies on top of ours
+		for (TActorIterator<ADirector> It(GetWorld()); It; ++It)
+		{
+			It->SetSpawningPaused(true);
+		}
+
+		PlayerAnchor = Player->GetActorLocation();
+		SetupScenario();
+		return;
+	}
+
+	case EPhase::Warmup:
+		DrivePlayer(DeltaTime);
+		if (++FrameCounter >= WarmupFrames)
+		{
+			// Drop whatever the stages recorded while settling
+			FSoulstrikeStageTimings::ConsumeFrame(StageFrameSeconds);
+			GameThreadSamples.Reset();
+			StageSamples.Reset();
+
+			Phase = EPhase::Measuring;
+			FrameCounter = 0;
+		}
+		return;
+
+	case EPhase::Measuring:
+		DrivePlayer(DeltaTime);
+		RecordFrame();
+		if (++FrameCounter >= MeasureFrames)
+		{
+			FinishScenario();
+			TeardownScenario();
+
+			if (++ScenarioIndex < EliteCounts.Num())
+			{
+				SetupScenario();
+			}
+			else
+			{
+				Finish();
+			}
+		}
+		return;
+	}
+}
+
+void USoulstrikeBenchmark::SetupScenario()
+{
+	UWorld* World = GetWorld();
+	const int32 NumElites = EliteCounts[ScenarioIndex];
+
+	TArray<UClass*> EliteClasses;
+	if (UEliteArchetypeRegistry* Registry = UEliteArchetypeRegistry::Get(World))
+	{
+		for (const FEliteArchetype& Archetype : Registry->Archetypes)
+		{
+			if (UClass* EliteClass = Archetype.PawnClass.LoadSynchronous())
+			{
+				EliteClasses.Add(EliteClass);
+			}
+		}
+	}
+
+	TSubclassOf<AActor> SwarmClass;
+	LoadBP::LoadClass("/Game/ThirdPersonBP/Blueprints/SwarmAI/BP_SwarmEnemy.BP_SwarmEnemy_C", SwarmClass);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	const FVector Extent(SpawnRadius, SpawnRadius, 10000.0f);
+	const float MinDistance = FMath::Min(1000.0f, SpawnRadius * 0.5f);
+
+	// Elites cycle through every archetype
+	int32 SpawnedElites = 0;
+	for (int32 i = 0; i < NumElites && EliteClasses.Num() > 0; ++i)
+	{
+		AActor* Elite = Spawn::SpawnActor(World, EliteClasses[i % EliteClasses.Num()], PlayerAnchor, Extent, MinDistance, 60.0f, false, SpawnParams, FVector(0, 0, 100));
+		if (Elite)
+		{
+			SpawnedActors.Add(Elite);
+			++SpawnedElites;
+		}
+	}
+
+	// Swarm enemies in packs, registered the way the Director does it
+	int32 SpawnedSwarm = 0;
+	FGuid PackId;
+	for (int32 i = 0; i < SwarmCount && SwarmClass; ++i)
+	{
+		if (i % SwarmPackSize == 0)
+		{
+			PackId = FGuid::NewGuid();
+		}
+
+		APawn* SwarmPawn = Cast<APawn>(Spawn::SpawnActor(World, SwarmClass, PlayerAnchor, Extent, MinDistance, 60.0f, false, SpawnParams, FVector(0, 0, 200)));
+		if (!SwarmPawn)
+			continue;
+
+		SpawnedActors.Add(SwarmPawn);
+		++SpawnedSwarm;
+
+		if (ASwarmAIController* Controller = Cast<ASwarmAIController>(SwarmPawn->GetController()))
+		{
+			Controller->RegisterSwarmEnemy(SwarmPawn, PackId);
+		}
+	}
+
+	FScenarioResult& Result = Results.AddDefaulted_GetRef();
+	Result.NumElites = SpawnedElites;
+	Result.NumSwarm = SpawnedSwarm;
+
+	Phase = EPhase::Warmup;
+	FrameCounter = 0;
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("SoulstrikeBenchmark: scenario %d - spawned %d/%d elites (%d archetypes), %d/%d swarm"),
+		ScenarioIndex, SpawnedElites, NumElites, EliteClasses.Num(), SpawnedSwarm, SwarmCount);
+}
+
+void USoulstrikeBenchmark::TeardownScenario()
+{
+	for (AActor* Actor : SpawnedActors)
+	{
+		if (!IsValid(Actor))
+			continue;
+
+		// Spawned pawns brought their own AI controllers
+		AController* Controller = nullptr;
+		if (APawn* Pawn = Cast<APawn>(Actor))
+		{
+			Controller = Pawn->GetController();
+		}
+
+		Actor->Destroy();
+		if (Controller)
+		{
+			Controller->Destroy();
+		}
+	}
+	SpawnedActors.Reset();
+}
+
+void USoulstrikeBenchmark::RecordFrame()
+{
+	// Game thread time of the frame that just ended
+	GameThreadSamples.Add(FPlatformTime::ToMilliseconds(GGameThreadTime));
+
+	FSoulstrikeStageTimings::ConsumeFrame(StageFrameSeconds);
+	if (StageSamples.Num() < StageFrameSeconds.Num())
+	{
+		StageSamples.SetNum(StageFrameSeconds.Num());
+	}
+	for (int32 Stage = 0; Stage < StageFrameSeconds.Num(); ++Stage)
+	{
+		StageSamples[Stage].Add(static_cast<float>(StageFrameSeconds[Stage] * 1000.0));
+	}
+}
+
+void USoulstrikeBenchmark::FinishScenario()
+{
+	FScenarioResult& Result = Results.Last();
+	Result.NumFrames = GameThreadSamples.Num();
+
+	GameThreadSamples.Sort();
+	Result.GameThreadP50 = Percentile(GameThreadSamples, 0.50f);
+	Result.GameThreadP95 = Percentile(GameThreadSamples, 0.95f);
+	Result.GameThreadP99 = Percentile(GameThreadSamples, 0.99f);
+
+	float Sum = 0.0f;
+	for (float Sample : GameThreadSamples)
+	{
+		Sum += Sample;
+	}
+	Result.GameThreadMean = Result.NumFrames > 0 ? Sum / Result.NumFrames : 0.0f;
+
+	// A stage that registered mid-scenario has fewer samples; missing frames count as zero
+	Result.StageMean.SetNumZeroed(StageSamples.Num());
+	Result.StageP95.SetNumZeroed(StageSamples.Num());
+	for (int32 Stage = 0; Stage < StageSamples.Num(); ++Stage)
+	{
+		TArray<float>& Samples = StageSamples[Stage];
+		Samples.SetNumZeroed(Result.NumFrames);
+
+		float StageSum = 0.0f;
+		for (float Sample : Samples)
+		{
+			StageSum += Sample;
+		}
+		Samples.Sort();
+		Result.StageMean[Stage] = Result.NumFrames > 0 ? StageSum / Result.NumFrames : 0.0f;
+		Result.StageP95[Stage] = Percentile(Samples, 0.95f);
+	}
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("SoulstrikeBenchmark: %d elites, %d swarm, %d frames - game thread p50 %.2f ms, p95 %.2f ms, p99 %.2f ms (mean %.2f)"),
+		Result.NumElites, Result.NumSwarm, Result.NumFrames,
+		Result.GameThreadP50, Result.GameThreadP95, Result.GameThreadP99, Result.GameThreadMean);
+	for (int32 Stage = 0; Stage < Result.StageMean.Num(); ++Stage)
+	{
+		UE_LOG(LogSoulstrikeAI, Display, TEXT("SoulstrikeBenchmark:   %-16s mean %.3f ms, p95 %.3f ms"),
+			FSoulstrikeStageTimings::GetName(Stage), Result.StageMean[Stage], Result.StageP95[Stage]);
+	}
+}
+
+void USoulstrikeBenchmark::Finish()
+{
+	Phase = EPhase::Idle;
+	FSoulstrikeStageTimings::SetEnabled(false);
+
+	for (TActorIterator<ADirector> It(GetWorld()); It; ++It)
+	{
+		It->SetSpawningPaused(false);
+	}
+
+	// One row per scenario, one mean/p95 column pair per stage
+	const int32 NumStages = FSoulstrikeStageTimings::Num();
+	FString Csv = TEXT("Elites,Swarm,Frames,GameThreadP50,GameThreadP95,GameThreadP99,GameThreadMean");
+	for (int32 Stage = 0; Stage < NumStages; ++Stage)
+	{
+		Csv += FString::Printf(TEXT(",%sMean,%sP95"), FSoulstrikeStageTimings::GetName(Stage), FSoulstrikeStageTimings::GetName(Stage));
+	}
+	Csv += LINE_TERMINATOR;
+
+	for (const FScenarioResult& Result : Results)
+	{
+		Csv += FString::Printf(TEXT("%d,%d,%d,%.3f,%.3f,%.3f,%.3f"), Result.NumElites, Result.NumSwarm, Result.NumFrames,
+			Result.GameThreadP50, Result.GameThreadP95, Result.GameThreadP99, Result.GameThreadMean);
+		for (int32 Stage = 0; Stage < NumStages; ++Stage)
+		{
+			const bool bHasStage = Result.StageMean.IsValidIndex(Stage);
+			Csv += FString::Printf(TEXT(",%.4f,%.4f"), bHasStage ? Result.StageMean[Stage] : 0.0f, bHasStage ? Result.StageP95[Stage] : 0.0f);
+		}
+		Csv += LINE_TERMINATOR;
+	}
+
+	const FString Filename = FPaths::ProfilingDir() / TEXT("Soulstrike") /
+		FString::Printf(TEXT("SoulstrikeBenchmark_%s.csv"), *FDateTime::Now().ToString());
+	if (FFileHelper::SaveStringToFile(Csv, *Filename))
+	{
+		UE_LOG(LogSoulstrikeAI, Display, TEXT("SoulstrikeBenchmark: results written to %s"), *Filename);
+	}
+	else
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("SoulstrikeBenchmark: could not write %s"), *Filename);
+	}
+
+	if (bQuitWhenDone)
+	{
+		RequestEngineExit(TEXT("Soulstrike benchmark complete"));
+	}
+}
+
+void USoulstrikeBenchmark::DrivePlayer(float DeltaTime)
+{
+	ACharacterBase* Player = Cast<ACharacterBase>(UGameplayStatics::GetPlayerCharacter(GetWorld(), 0));
+	if (!Player)
+		return;
+
+	// A dead player would end the fight halfway through the measurement
+	Player->CurrentHP = Player->MaxHP;
+
+	if (bScriptedPlayer)
+	{
+		PlayerAngle = FMath::Fmod(PlayerAngle + DeltaTime * 0.5f, 2.0f * PI);
+		const FVector Offset(FMath::Cos(PlayerAngle) * 800.0f, FMath::Sin(PlayerAngle) * 800.0f, 0.0f);
+		Player->SetActorLocation(PlayerAnchor + Offset);
+	}
+}
+
+float USoulstrikeBenchmark::Percentile(TArray<float>& SortedSamples, float Fraction)
+{
+	if (SortedSamples.Num() == 0)
+		return 0.0f;
+
+	// Nearest rank
+	const int32 Rank = FMath::CeilToInt(Fraction * SortedSamples.Num()) - 1;
+	return SortedSamples[FMath::Clamp(Rank, 0, SortedSamples.Num() - 1)];
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SoulstrikeTickableWorldSubsystem.h"
+#include "SoulstrikeBenchmark.generated.h"
+
+/**
+ * Soulstrike Benchmark - headless AI scale benchmark.
+ * Spawns a given number of elites (spread over every archetype) and swarm enemies around the
+ * player, lets them settle, then measures a fixed number of frames and reports p50/p95/p99 game
+ * thread milliseconds plus the cost of every AI stage. Scenarios run back to back in one session.
+ *
+ * Start from the command line (works with -nullrhi, no GPU needed):
+ *   -SoulstrikeBenchmark -BenchElites=5,50,500 -BenchSwarm=1000 -BenchFrames=1000 [-BenchAIRate=20] [-BenchScripted]
+ * or in a running game: Soulstrike.AI.Benchmark BenchElites=50 BenchSwarm=200
+ * Results go to the log and to Saved/Profiling/Soulstrike/. A command-line run quits when done.
+ */
+UCLASS()
+class SOULSTRIKE_API USoulstrikeBenchmark : public USoulstrikeTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the benchmark for a world (null for non-game worlds) */
+	static USoulstrikeBenchmark* Get(const UWorld* World);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Start a run with options in command-line form (BenchElites=, BenchSwarm=, BenchFrames=, ...) */
+	void Start(const TCHAR* Options);
+
+	bool IsRunning() const { return Phase != EPhase::Idle; }
+
+	/** Console entry point (Soulstrike.AI.Benchmark) */
+	static void StartFromConsole(const TArray<FString>& Args, UWorld* World);
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		WaitingForPlayer,
+		Warmup,
+		Measuring
+	};
+
+	struct FScenarioResult
+	{
+		int32 NumElites = 0;
+		int32 NumSwarm = 0;
+		int32 NumFrames = 0;
+		float GameThreadP50 = 0.0f;
+		float GameThreadP95 = 0.0f;
+		float GameThreadP99 = 0.0f;
+		float GameThreadMean = 0.0f;
+
+		/** Mean and p95 ms per AI stage, indexed like FSoulstrikeStageTimings */
+		TArray<float> StageMean;
+		TArray<float> StageP95;
+	};
+
+	/** Spawn the current scenario's enemies around the player */
+	void SetupScenario();
+
+	/** Destroy what the scenario spawned */
+	void TeardownScenario();
+
+	/** Sample the frame that just finished */
+	void RecordFrame();
+
+	/** Percentiles for the current scenario */
+	void FinishScenario();
+
+	/** Log and write the results; quit if the run came from the command line */
+	void Finish();
+
+	/** Keep the player alive and, if scripted, circling */
+	void DrivePlayer(float DeltaTime);
+
+	static float Percentile(TArray<float>& SortedSamples, float Fraction);
+
+	EPhase Phase = EPhase::Idle;
+
+	// ========== CONFIGURATION ==========
+
+	TArray<int32> EliteCounts;
+	int32 SwarmCount = 0;
+	int32 SwarmPackSize = 10;
+	int32 WarmupFrames = 120;
+	int32 MeasureFrames = 1000;
+	float SpawnRadius = 4000.0f;
+	bool bScriptedPlayer = false;
+	bool bQuitWhenDone = false;
+
+	// ========== RUN STATE ==========
+
+	int32 ScenarioIndex = 0;
+	int32 FrameCounter = 0;
+
+	FVector PlayerAnchor = FVector::ZeroVector;
+	float PlayerAngle = 0.0f;
+
+	UPROPERTY()
+	TArray<AActor*> SpawnedActors;
+
+	TArray<float> GameThreadSamples;
+	TArray<TArray<float>> StageSamples;
+	TArray<double> StageFrameSeconds;
+
+	TArray<FScenarioResult> Results;
+};
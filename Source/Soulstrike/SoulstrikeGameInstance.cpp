@@ -1 +1,189 @@
 #include "SoulstrikeGameInstance.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeStats.h"
+#include "Misc/CommandLine.h"
+#include "Containers/Ticker.h"
+#include "Misc/Parse.h"
+#include "Engine/Engine.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "GameFramework/PlayerController.h"
+#include "AI/NavigationSystemBase.h"
+#include "UObject/LinkerInstancingContext.h"
+#include "UObject/Package.h"
+
+void USoulstrikeGameInstance::Init()
+{
+	Super::Init();
+
+	float SoakMinutes = 0.0f;
+	if (FParse::Value(FCommandLine::Get(), TEXT("SoulstrikeSoakMinutes="), SoakMinutes) && SoakMinutes > 0.0f)
+	{
+		StartSoakCapture(SoakMinutes);
+	}
+}
+
+void USoulstrikeGameInstance::Shutdown()
+{
+	DestroySimWorlds();
+
+	// Quitting before the soak ran out - keep what was captured
+	if (SoakTickerHandle.IsValid())
+	{
+		FTicker::GetCoreTicker().RemoveTicker(SoakTickerHandle);
+		SoakTickerHandle.Reset();
+		EndSoakCapture();
+	}
+
+	Super::Shutdown();
+}
+
+void USoulstrikeGameInstance::StartSoakCapture(float Minutes)
+{
+#if CSV_PROFILER
+	FCsvProfiler* Profiler = FCsvProfiler::Get();
+	if (Profiler->IsCapturing())
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("SoulstrikeGameInstance: CSV capture already running, soak capture not started"));
+		return;
+	}
+
+	const FString Filename = FString::Printf(TEXT("SoulstrikeSoak_%s.csv"), *FDateTime::Now().ToString());
+	Profiler->BeginCapture(-1, FString(), Filename);
+
+	SoakEndTime = FPlatformTime::Seconds() + Minutes * 60.0;
+	SoakTickerHandle = FTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &USoulstrikeGameInstance::TickSoakCapture), 1.0f);
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("SoulstrikeGameInstance: Soak capture started for %.1f minutes (%s)"), Minutes, *Filename);
+#else
+	UE_LOG(LogSoulstrikeAI, Warning, TEXT("SoulstrikeGameInstance: -SoulstrikeSoakMinutes ignored, CSV profiler is compiled out of this build"));
+#endif
+}
+
+bool USoulstrikeGameInstance::TickSoakCapture(float DeltaTime)
+{
+	if (FPlatformTime::Seconds() < SoakEndTime)
+		return true;
+
+	// Returning false removes the ticker
+	SoakTickerHandle.Reset();
+	EndSoakCapture();
+
+	if (FParse::Param(FCommandLine::Get(), TEXT("SoulstrikeSoakExit")))
+	{
+		RequestEngineExit(TEXT("Soulstrike soak capture complete"));
+	}
+
+	return false;
+}
+
+void USoulstrikeGameInstance::EndSoakCapture()
+{
+#if CSV_PROFILER
+	if (FCsvProfiler::Get()->IsCapturing())
+	{
+		FCsvProfiler::Get()->EndCapture();
+		UE_LOG(LogSoulstrikeAI, Display, TEXT("SoulstrikeGameInstance: Soak capture finished"));
+	}
+#endif
+}
+
+void USoulstrikeGameInstance::StartSimWorlds(UWorld* PrimaryWorld, int32 Count)
+{
+	if (!PrimaryWorld || SimWorlds.Num() > 0)
+		return;
+
+	const FString MapPackageName = PrimaryWorld->GetOutermost()->GetName();
+	for (int32 Index = 1; Index <= Count; ++Index)
+	{
+		if (UWorld* World = CreateSimWorld(MapPackageName, Index))
+		{
+			SimWorlds.Add(World);
+		}
+	}
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("SoulstrikeGameInstance: %d/%d simulation worlds of %s started"), SimWorlds.Num(), Count, *MapPackageName);
+}
+
+int32 USoulstrikeGameInstance::GetSimWorldIndex(const UWorld* World) const
+{
+	return SimWorlds.IndexOfByKey(World) + 1;
+}
+
+UWorld* USoulstrikeGameInstance::CreateSimWorld(const FString& MapPackageName, int32 Index)
+{
+	// A second copy of a loaded map needs its own package name, the way level instances are loaded
+	const FString Suffix = FString::Printf(TEXT("_Sim%d"), Index);
+	const FString InstancePackageName = MapPackageName + Suffix;
+
+	FLinkerInstancingContext InstancingContext;
+	InstancingContext.AddMapping(FName(*MapPackageName), FName(*InstancePackageName));
+
+	UPackage* InstancePackage = CreatePackage(*InstancePackageName);
+	InstancePackage->SetPackageFlags(PKG_ContainsMap);
+
+	UPackage* Package = LoadPackage(InstancePackage, *MapPackageName, LOAD_None, nullptr, &InstancingContext);
+	UWorld* World = Package ? UWorld::FindWorldInPackage(Package) : nullptr;
+	if (!World)
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("SoulstrikeGameInstance: could not load %s as simulation world %d"), *MapPackageName, Index);
+		return nullptr;
+	}
+
+	// Sublevels would otherwise resolve to the primary world's already loaded copies
+	for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+	{
+		const FName SublevelPackageName = StreamingLevel->GetWorldAssetPackageFName();
+		StreamingLevel->PackageNameToLoad = SublevelPackageName;
+		StreamingLevel->SetWorldAssetByPackageName(FName(*(SublevelPackageName.ToString() + Suffix)));
+	}
+
+	// Same steps as UEngine::LoadMap, minus local players
+	World->WorldType = EWorldType::Game;
+	World->SetGameInstance(this);
+
+	FWorldContext& Context = GEngine->CreateNewWorldContext(EWorldType::Game);
+	Context.OwningGameInstance = this;
+	Context.SetCurrentWorld(World);
+
+	const FURL URL(*MapPackageName);
+	World->InitWorld();
+	World->SetGameMode(URL);
+	FNavigationSystem::AddNavigationSystemToWorld(*World, FNavigationSystemRunMode::GameMode);
+	World->CreateAISystem();
+	World->InitializeActorsForPlay(URL);
+	World->FlushLevelStreaming(EFlushLevelStreamingType::Full);
+
+	// The player is a controller without a local player; the world's training run drives its pawn.
+	// Like LoadMap's play actors it must exist before BeginPlay - actors cache the player there.
+	AGameModeBase* GameMode = World->GetAuthGameMode();
+	APlayerController* BotController = GameMode ? GameMode->SpawnPlayerController(ROLE_SimulatedProxy, FString()) : nullptr;
+	if (BotController)
+	{
+		GameMode->RestartPlayer(BotController);
+	}
+
+	if (!BotController || !BotController->GetPawn())
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("SoulstrikeGameInstance: simulation world %d has no player pawn"), Index);
+	}
+
+	World->BeginPlay();
+
+	return World;
+}
+
+void USoulstrikeGameInstance::DestroySimWorlds()
+{
+	for (UWorld* World : SimWorlds)
+	{
+		if (!World)
+			continue;
+
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+	}
+	SimWorlds.Empty();
+}
@@ -19,7 +19,51 @@ class SOULSTRIKE_API USoulstrikeGameInstance : public UGameInstance
 	GENERATED_BODY()
 
 public:
+	virtual void Init() override;
+	virtual void Shutdown() override;
+
 	/** Delegate broadcast when player position changes */
 	UPROPERTY(BlueprintAssignable, Category = "Events")
 	FOnPlayerPositionUpdated OnPlayerPositionUpdated;
+
+	// ========== SIMULATION WORLDS ==========
+
+	/**
+	 * Load Count more independent copies of PrimaryWorld's map next to it, each a full game world
+	 * with its own game mode, Director, elites and a bot-controlled player. The engine ticks every
+	 * game world context each frame, so they run interleaved with the primary world on the game
+	 * thread. While they run, every elite that dies merges what it learned since spawning into
+	 * UWeightManager (see MergeWeights) instead of saving over it, and new elites in any world start
+	 * from the pooled weights.
+	 */
+	void StartSimWorlds(UWorld* PrimaryWorld, int32 Count);
+
+	/** 0 for the world the game started in, 1.. for worlds added by StartSimWorlds */
+	int32 GetSimWorldIndex(const UWorld* World) const;
+
+	bool HasSimWorlds() const { return SimWorlds.Num() > 0; }
+
+private:
+	/** Load, initialize and begin play on one more copy of the map; null if the map failed to load */
+	UWorld* CreateSimWorld(const FString& MapPackageName, int32 Index);
+
+	void DestroySimWorlds();
+
+	UPROPERTY()
+	TArray<UWorld*> SimWorlds;
+
+	// ========== SOAK CAPTURE ==========
+
+	/**
+	 * Record a CSV profile for the given minutes (-SoulstrikeSoakMinutes=N on the command line;
+	 * add -SoulstrikeSoakExit to quit once it is written)
+	 */
+	void StartSoakCapture(float Minutes);
+
+	bool TickSoakCapture(float DeltaTime);
+
+	void EndSoakCapture();
+
+	FDelegateHandle SoakTickerHandle;
+	double SoakEndTime = 0.0;
 };
@@ -0,0 +1,41 @@
+#include "SoulstrikeLog.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY(LogSoulstrikeAI);
+DEFINE_LOG_CATEGORY(LogSoulstrikeDirector);
+DEFINE_LOG_CATEGORY(LogSoulstrikeSwarm);
+
+FSoulstrikeLogSummary::FSoulstrikeLogSummary(const TCHAR* InEventName, double InIntervalSeconds)
+	: EventName(InEventName)
+	, IntervalSeconds(InIntervalSeconds)
+	, IntervalStart(FPlatformTime::Seconds())
+{
+}
+
+bool FSoulstrikeLogSummary::Add(float Amount)
+{
+	Max = Count > 0 ? FMath::Max(Max, Amount) : Amount;
+	++Count;
+	Sum += Amount;
+	bHasAmounts |= Amount != 0.0f;
+
+	return FPlatformTime::Seconds() - IntervalStart >= IntervalSeconds;
+}
+
+FString FSoulstrikeLogSummary::Flush()
+{
+	const double Now = FPlatformTime::Seconds();
+	const double Elapsed = Now - IntervalStart;
+
+	FString Line = bHasAmounts
+		? FString::Printf(TEXT("%s: %d in %.1fs (total %.1f, max %.1f)"), EventName, Count, Elapsed, Sum, Max)
+		: FString::Printf(TEXT("%s: %d in %.1fs"), EventName, Count, Elapsed);
+
+	IntervalStart = Now;
+	Count = 0;
+	Sum = 0.0f;
+	Max = 0.0f;
+	bHasAmounts = false;
+
+	return Line;
+}
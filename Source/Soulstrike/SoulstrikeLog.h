@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Logging/LogMacros.h"
+
+/**
+ * Soulstrike log categories. Shipping and Test builds compile everything below Warning out of
+ * the AI categories, so hot-path Log/Verbose lines cost nothing there.
+ */
+#if UE_BUILD_SHIPPING || UE_BUILD_TEST
+	#define SOULSTRIKE_LOG_COMPILE_VERBOSITY Warning
+#else
+	#define SOULSTRIKE_LOG_COMPILE_VERBOSITY All
+#endif
+
+/** Elites: RL components, brains, weights and the per-world AI subsystems */
+SOULSTRIKE_API DECLARE_LOG_CATEGORY_EXTERN(LogSoulstrikeAI, Log, SOULSTRIKE_LOG_COMPILE_VERBOSITY);
+
+/** Director: spawn credits and spawning */
+SOULSTRIKE_API DECLARE_LOG_CATEGORY_EXTERN(LogSoulstrikeDirector, Log, SOULSTRIKE_LOG_COMPILE_VERBOSITY);
+
+/** Swarm enemies */
+SOULSTRIKE_API DECLARE_LOG_CATEGORY_EXTERN(LogSoulstrikeSwarm, Log, SOULSTRIKE_LOG_COMPILE_VERBOSITY);
+
+/**
+ * Per-second summary of a high-frequency event (damage taken, attack hits, heals...).
+ * Events are counted and their amounts summed; one line per interval is emitted instead of one
+ * per event. Game thread only. Use through SOULSTRIKE_LOG_SUMMARY, which keeps one summary per
+ * call site.
+ */
+class SOULSTRIKE_API FSoulstrikeLogSummary
+{
+public:
+	explicit FSoulstrikeLogSummary(const TCHAR* InEventName, double InIntervalSeconds = 1.0);
+
+	/** Count one event. Returns true when the interval is up and the summary should be emitted */
+	bool Add(float Amount);
+
+	/** Summary line for the interval so far; starts the next interval */
+	FString Flush();
+
+private:
+	const TCHAR* EventName;
+	double IntervalSeconds;
+
+	double IntervalStart = 0.0;
+	int32 Count = 0;
+	float Sum = 0.0f;
+	float Max = 0.0f;
+	bool bHasAmounts = false;
+};
+
+/**
+ * Count an event toward its call site's per-second summary and emit the summary when due.
+ * Pass 0 as Amount for events without a size. Compiles out with the category.
+ *   SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeAI, Log, "Elite damage taken", HealthLost);
+ */
+#define SOULSTRIKE_LOG_SUMMARY(CategoryName, Verbosity, EventName, Amount) \
+	do \
+	{ \
+		if (UE_LOG_ACTIVE(CategoryName, Verbosity)) \
+		{ \
+			static FSoulstrikeLogSummary LogSummary(TEXT(EventName)); \
+			if (LogSummary.Add(Amount)) \
+			{ \
+				UE_LOG(CategoryName, Verbosity, TEXT("%s"), *LogSummary.Flush()); \
+			} \
+		} \
+	} while (0)
@@ -0,0 +1,225 @@
+#include "SoulstrikePlayerBot.h"
+#include "CharacterBase.h"
+#include "EliteArchetypeComponent.h"
+#include "EliteCombatTimeline.h"
+#include "EliteWorldSnapshot.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/DamageType.h"
+#include "Kismet/GameplayStatics.h"
+
+void FSoulstrikePlayerBot::Start(ACharacterBase* InPlayer, const FSettings& InSettings, int32 Seed)
+{
+	Player = InPlayer;
+	Settings = InSettings;
+	Random.Initialize(Seed);
+
+	Anchor = InPlayer ? InPlayer->GetActorLocation() : FVector::ZeroVector;
+	MoveDirection = FVector::ZeroVector;
+	DodgeDirection = FVector::ZeroVector;
+	Target = nullptr;
+
+	ThinkTimer = 0.0f;
+	FireTimer = Settings.FireInterval;
+	StrafeTimer = Settings.StrafeFlipSeconds;
+	DodgeTimer = 0.0f;
+	StrafeSign = Random.FRand() < 0.5f ? -1.0f : 1.0f;
+}
+
+void FSoulstrikePlayerBot::Tick(float DeltaTime)
+{
+	ACharacterBase* Character = Player.Get();
+	if (!Character)
+		return;
+
+	UWorld* World = Character->GetWorld();
+
+	// A death ends the episode - respawn at the anchor and keep going
+	if (Character->CurrentHP <= 0.0f)
+	{
+		++Deaths;
+		Character->CurrentHP = Character->MaxHP;
+		Character->SetActorLocation(Anchor, false, nullptr, ETeleportType::ResetPhysics);
+		DodgeTimer = 0.0f;
+	}
+
+	ThinkTimer -= DeltaTime;
+	if (ThinkTimer <= 0.0f)
+	{
+		ThinkTimer += Settings.ThinkInterval;
+		if (DodgeTimer <= 0.0f && !TryDodge(World))
+		{
+			Think(World);
+		}
+	}
+
+	FireTimer -= DeltaTime;
+	if (FireTimer <= 0.0f)
+	{
+		FireTimer += Settings.FireInterval;
+		Fire(World);
+	}
+
+	FVector Direction = MoveDirection;
+	if (DodgeTimer > 0.0f)
+	{
+		DodgeTimer -= DeltaTime;
+		Direction = DodgeDirection;
+	}
+
+	if (!Direction.IsNearlyZero())
+	{
+		Character->AddMovementInput(Direction, 1.0f);
+	}
+}
+
+void FSoulstrikePlayerBot::Think(UWorld* World)
+{
+	const ACharacterBase* Character = Player.Get();
+	const FVector Location = Character->GetActorLocation();
+
+	// Nearest living elite is both what we kite and what we shoot
+	ACharacter* Nearest = nullptr;
+	float NearestDistSq = MAX_FLT;
+	for (TActorIterator<ACharacter> It(World); It; ++It)
+	{
+		if (!UEliteArchetypeComponent::FindArchetype(*It) || FEliteWorldSnapshot::ReadHealthPercentage(*It) <= 0.0f)
+			continue;
+
+		const float DistSq = FVector::DistSquared2D(It->GetActorLocation(), Location);
+		if (DistSq < NearestDistSq)
+		{
+			Nearest = *It;
+			NearestDistSq = DistSq;
+		}
+	}
+	Target = Nearest;
+
+	StrafeTimer -= Settings.ThinkInterval;
+	if (StrafeTimer <= 0.0f)
+	{
+		StrafeSign = -StrafeSign;
+		StrafeTimer = Settings.StrafeFlipSeconds * Random.FRandRange(0.5f, 1.5f);
+	}
+
+	FVector Direction = FVector::ZeroVector;
+	if (Nearest)
+	{
+		const FVector ToTarget = (Nearest->GetActorLocation() - Location).GetSafeNormal2D();
+		const FVector Tangent = FVector::CrossProduct(FVector::UpVector, ToTarget) * StrafeSign;
+		const float Distance = FMath::Sqrt(NearestDistSq);
+
+		// Back off when crowded, close in when too far, otherwise circle
+		float Radial = 0.0f;
+		if (Distance < Settings.PreferredDistance - Settings.DistanceTolerance)
+		{
+			Radial = -1.0f;
+		}
+		else if (Distance > Settings.PreferredDistance + Settings.DistanceTolerance)
+		{
+			Radial = 1.0f;
+		}
+		Direction = ToTarget * Radial + Tangent;
+	}
+	else
+	{
+		// Nothing to fight yet - patrol around the anchor so spawns come from all sides
+		Direction = FVector::CrossProduct(FVector::UpVector, (Location - Anchor).GetSafeNormal2D()) * StrafeSign;
+	}
+
+	// Don't wander off the playable area chasing or fleeing
+	const FVector ToAnchor = Anchor - Location;
+	const float AnchorDistance = ToAnchor.Size2D();
+	if (AnchorDistance > Settings.LeashRadius)
+	{
+		Direction += ToAnchor.GetSafeNormal2D() * (AnchorDistance / Settings.LeashRadius);
+	}
+
+	MoveDirection = Direction.GetSafeNormal2D();
+}
+
+bool FSoulstrikePlayerBot::TryDodge(UWorld* World)
+{
+	UEliteCombatTimeline* Timeline = UEliteCombatTimeline::Get(World);
+	if (!Timeline)
+		return false;
+
+	ACharacterBase* Character = Player.Get();
+	const FVector Location = Character->GetActorLocation();
+
+	Timeline->GetAttackersDueWithin(Settings.DodgeWarningSeconds, Attackers);
+
+	const AActor* Closest = nullptr;
+	float ClosestDistSq = FMath::Square(Settings.DodgeTriggerDistance);
+	for (const AActor* Attacker : Attackers)
+	{
+		const float DistSq = FVector::DistSquared2D(Attacker->GetActorLocation(), Location);
+		if (DistSq < ClosestDistSq)
+		{
+			Closest = Attacker;
+			ClosestDistSq = DistSq;
+		}
+	}
+
+	if (!Closest)
+		return false;
+
+	// Out and to the side, so range checks at the end of the windup miss
+	const FVector Away = (Location - Closest->GetActorLocation()).GetSafeNormal2D();
+	const FVector Side = FVector::CrossProduct(FVector::UpVector, Away) * (Random.FRand() < 0.5f ? -1.0f : 1.0f);
+	DodgeDirection = (Away + Side).GetSafeNormal2D();
+	DodgeTimer = Settings.DodgeSeconds;
+	++Dodges;
+
+	if (Character->GetCharacterMovement() && Character->GetCharacterMovement()->IsMovingOnGround())
+	{
+		Character->Jump();
+	}
+	return true;
+}
+
+void FSoulstrikePlayerBot::Fire(UWorld* World)
+{
+	ACharacter* Elite = Target.Get();
+	const ACharacterBase* Character = Player.Get();
+	if (!Elite || FEliteWorldSnapshot::ReadHealthPercentage(Elite) <= 0.0f)
+		return;
+
+	const FVector Start = Character->GetActorLocation();
+	const FVector End = Elite->GetActorLocation();
+	if (FVector::DistSquared(Start, End) > FMath::Square(Settings.FireRange))
+		return;
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(SoulstrikePlayerBotFire), false, Character);
+	Params.AddIgnoredActor(Elite);
+	if (World->LineTraceTestByChannel(Start, End, ECC_Visibility, Params))
+		return;
+
+	++ShotsFired;
+	if (Random.FRand() < Settings.Accuracy)
+	{
+		++ShotsHit;
+		ApplyHit(Elite);
+	}
+}
+
+void FSoulstrikePlayerBot::ApplyHit(ACharacter* Elite)
+{
+	ACharacterBase* Character = Player.Get();
+
+	FProperty* CurrentHealthProp = Elite->GetClass()->FindPropertyByName(TEXT("CurrentHealth"));
+	float* CurrentHealthPtr = CurrentHealthProp ? CurrentHealthProp->ContainerPtrToValuePtr<float>(Elite) : nullptr;
+	const float HealthBefore = CurrentHealthPtr ? *CurrentHealthPtr : 0.0f;
+
+	// Same entry point as the player's weapons, so Blueprint hit reactions and deaths run
+	UGameplayStatics::ApplyDamage(Elite, Settings.FireDamage, Character->GetController(), Character, UDamageType::StaticClass());
+
+	// Elite Blueprints without an AnyDamage handler take the hit on their health directly
+	if (CurrentHealthPtr && *CurrentHealthPtr == HealthBefore)
+	{
+		*CurrentHealthPtr = FMath::Max(0.0f, HealthBefore - Settings.FireDamage);
+	}
+
+	DamageDealt += Settings.FireDamage;
+}
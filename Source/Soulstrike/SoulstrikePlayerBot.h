@@ -0,0 +1,95 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+class ACharacter;
+class ACharacterBase;
+class UWorld;
+
+/**
+ * Scripted stand-in for the human player in headless training runs.
+ * Drives the real player character through its movement component (so physics and navigation
+ * behave as in play) with a simple kiting fighter:
+ *   - move: hold a preferred distance to the nearest elite while strafing around it, flipping
+ *     strafe direction now and then, and drift back toward the start point past a leash radius
+ *   - dodge: when an attack windup against the player is about to resolve and its attacker is
+ *     close, sidestep away from it and jump
+ *   - shoot: on a fixed interval, hit the nearest elite in range and line of sight with a
+ *     fixed accuracy
+ * Elites are the characters carrying a UEliteArchetypeComponent, the same set the RL AI works on;
+ * hits go through UGameplayStatics::ApplyDamage, falling back to the Blueprint CurrentHealth.
+ * Decisions are taken at ThinkInterval and seeded, so a run with the same seed and map replays
+ * the same bot choices for the same world.
+ */
+class SOULSTRIKE_API FSoulstrikePlayerBot
+{
+public:
+	struct FSettings
+	{
+		float ThinkInterval = 0.1f;
+		float PreferredDistance = 1200.0f;
+		float DistanceTolerance = 300.0f;
+		float LeashRadius = 3000.0f;
+		float StrafeFlipSeconds = 2.5f;
+
+		float FireRange = 2500.0f;
+		float FireInterval = 0.5f;
+		float FireDamage = 20.0f;
+		float Accuracy = 0.7f;
+
+		/** React to windups resolving this soon from attackers this close */
+		float DodgeWarningSeconds = 0.35f;
+		float DodgeTriggerDistance = 800.0f;
+		float DodgeSeconds = 0.3f;
+	};
+
+	/** Take over the player; where it stands now is where it respawns and what the leash pulls back to */
+	void Start(ACharacterBase* InPlayer, const FSettings& InSettings, int32 Seed);
+
+	void Tick(float DeltaTime);
+
+	bool IsRunning() const { return Player.IsValid(); }
+
+	int32 GetShotsFired() const { return ShotsFired; }
+	int32 GetShotsHit() const { return ShotsHit; }
+	int32 GetDodges() const { return Dodges; }
+	int32 GetDeaths() const { return Deaths; }
+	float GetDamageDealt() const { return DamageDealt; }
+
+private:
+	/** Pick the target and the move direction for the next ThinkInterval */
+	void Think(UWorld* World);
+
+	/** Sidestep away from the closest attacker about to land a hit, if any */
+	bool TryDodge(UWorld* World);
+
+	void Fire(UWorld* World);
+
+	/** Damage an elite the way a player shot would */
+	void ApplyHit(ACharacter* Elite);
+
+	TWeakObjectPtr<ACharacterBase> Player;
+	FSettings Settings;
+	FRandomStream Random;
+
+	FVector Anchor = FVector::ZeroVector;
+	FVector MoveDirection = FVector::ZeroVector;
+	FVector DodgeDirection = FVector::ZeroVector;
+	TWeakObjectPtr<ACharacter> Target;
+
+	float ThinkTimer = 0.0f;
+	float FireTimer = 0.0f;
+	float StrafeTimer = 0.0f;
+	float DodgeTimer = 0.0f;
+	float StrafeSign = 1.0f;
+
+	/** Reused every think */
+	TArray<AActor*> Attackers;
+
+	int32 ShotsFired = 0;
+	int32 ShotsHit = 0;
+	int32 Dodges = 0;
+	int32 Deaths = 0;
+	float DamageDealt = 0.0f;
+};
@@ -0,0 +1,112 @@
+#include "SoulstrikeStats.h"
+
+CSV_DEFINE_CATEGORY_MODULE(SOULSTRIKE_API, SoulstrikeAI, true);
+CSV_DEFINE_CATEGORY_MODULE(SOULSTRIKE_API, SoulstrikeDirector, true);
+
+// ========== STAGE TIMINGS ==========
+
+bool FSoulstrikeStageTimings::bEnabled = false;
+int32 FSoulstrikeStageTimings::NumStages = 0;
+const TCHAR* FSoulstrikeStageTimings::Names[MaxStages] = {};
+double FSoulstrikeStageTimings::Seconds[MaxStages] = {};
+
+int32 FSoulstrikeStageTimings::Register(const TCHAR* Name)
+{
+	for (int32 Stage = 0; Stage < NumStages; ++Stage)
+	{
+		if (FCString::Strcmp(Names[Stage], Name) == 0)
+			return Stage;
+	}
+
+	if (!ensureMsgf(NumStages < MaxStages, TEXT("Too many Soulstrike AI stages, raise MaxStages")))
+		return INDEX_NONE;
+
+	Names[NumStages] = Name;
+	return NumStages++;
+}
+
+void FSoulstrikeStageTimings::ConsumeFrame(TArray<double>& OutSeconds)
+{
+	OutSeconds.SetNumUninitialized(NumStages);
+	for (int32 Stage = 0; Stage < NumStages; ++Stage)
+	{
+		OutSeconds[Stage] = Seconds[Stage];
+		Seconds[Stage] = 0.0;
+	}
+}
+
+// ========== SIGNIFICANCE TIERS ==========
+
+DEFINE_STAT(STAT_SoulstrikeAI_StepHigh);
+DEFINE_STAT(STAT_SoulstrikeAI_StepMedium);
+DEFINE_STAT(STAT_SoulstrikeAI_StepLow);
+DEFINE_STAT(STAT_SoulstrikeAI_Significance);
+
+DEFINE_STAT(STAT_SoulstrikeAI_ElitesHigh);
+DEFINE_STAT(STAT_SoulstrikeAI_ElitesMedium);
+DEFINE_STAT(STAT_SoulstrikeAI_ElitesLow);
+DEFINE_STAT(STAT_SoulstrikeAI_LiveElites);
+
+// ========== RL SCHEDULER ==========
+
+DEFINE_STAT(STAT_SoulstrikeAI_RLScheduler);
+DEFINE_STAT(STAT_SoulstrikeAI_PhaseBegin);
+DEFINE_STAT(STAT_SoulstrikeAI_PhaseBuildStates);
+DEFINE_STAT(STAT_SoulstrikeAI_PhaseRewards);
+DEFINE_STAT(STAT_SoulstrikeAI_PhaseInference);
+DEFINE_STAT(STAT_SoulstrikeAI_PhaseApply);
+
+DEFINE_STAT(STAT_SoulstrikeAI_RLSteps);
+DEFINE_STAT(STAT_SoulstrikeAI_RLStepsDeferred);
+DEFINE_STAT(STAT_SoulstrikeAI_RLDecisions);
+
+// ========== STATUS EFFECTS ==========
+
+DEFINE_STAT(STAT_SoulstrikeAI_StatusEffects);
+
+DEFINE_STAT(STAT_SoulstrikeAI_ActiveStatusEffects);
+
+// ========== COMBAT EVENTS ==========
+
+DEFINE_STAT(STAT_SoulstrikeAI_CombatEvents);
+
+DEFINE_STAT(STAT_SoulstrikeAI_CombatEventsQueued);
+
+// ========== COMBAT TIMELINE ==========
+
+DEFINE_STAT(STAT_SoulstrikeAI_CombatTimeline);
+
+DEFINE_STAT(STAT_SoulstrikeAI_PendingWindups);
+
+// ========== ELITE STAGES ==========
+
+DEFINE_STAT(STAT_SoulstrikeAI_WorldSnapshot);
+DEFINE_STAT(STAT_SoulstrikeAI_BuildState);
+DEFINE_STAT(STAT_SoulstrikeAI_FindClosestAllies);
+DEFINE_STAT(STAT_SoulstrikeAI_LineOfSight);
+DEFINE_STAT(STAT_SoulstrikeAI_SelectAction);
+DEFINE_STAT(STAT_SoulstrikeAI_UpdateWeights);
+DEFINE_STAT(STAT_SoulstrikeAI_EvaluateReward);
+DEFINE_STAT(STAT_SoulstrikeAI_ExecuteAction);
+
+DEFINE_STAT(STAT_SoulstrikeAI_PathRequests);
+DEFINE_STAT(STAT_SoulstrikeAI_MovesCoalesced);
+DEFINE_STAT(STAT_SoulstrikeAI_MoveGoalCacheHits);
+DEFINE_STAT(STAT_SoulstrikeAI_MovePathsFailed);
+
+// ========== TRACES ==========
+
+DEFINE_STAT(STAT_SoulstrikeAI_TracesIssued);
+DEFINE_STAT(STAT_SoulstrikeAI_SwarmTraces);
+
+// ========== SWARM ==========
+
+DEFINE_STAT(STAT_SoulstrikeAI_SwarmMovement);
+DEFINE_STAT(STAT_SoulstrikeAI_SwarmAttack);
+
+DEFINE_STAT(STAT_SoulstrikeAI_SwarmMembers);
+
+// ========== DIRECTOR ==========
+
+DEFINE_STAT(STAT_SoulstrikeAI_TickDirector);
+DEFINE_STAT(STAT_SoulstrikeAI_SpawnActor);
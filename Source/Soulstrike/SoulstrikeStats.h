@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/**
+ * Soulstrike AI stats - `stat SoulstrikeAI` in the console
+ */
+DECLARE_STATS_GROUP(TEXT("Soulstrike AI"), STATGROUP_SoulstrikeAI, STATCAT_Advanced);
+
+/**
+ * CSV profiler categories - per-frame AI timings and counters for long captures
+ * (-SoulstrikeSoakMinutes=N, or any csvprofile capture)
+ */
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(SOULSTRIKE_API, SoulstrikeAI);
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(SOULSTRIKE_API, SoulstrikeDirector);
+
+/**
+ * Per-stage game thread timings read by the AI benchmark. Collection is off unless a benchmark
+ * is running, so a stage scope costs one branch otherwise. Game thread only.
+ */
+class SOULSTRIKE_API FSoulstrikeStageTimings
+{
+public:
+	static constexpr int32 MaxStages = 32;
+
+	/** Index for a stage name (called once per SOULSTRIKE_AI_STAGE site) */
+	static int32 Register(const TCHAR* Name);
+
+	static int32 Num() { return NumStages; }
+	static const TCHAR* GetName(int32 Stage) { return Names[Stage]; }
+
+	static void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+
+	/** Seconds spent in each stage since the last call (Num() entries); starts the next frame */
+	static void ConsumeFrame(TArray<double>& OutSeconds);
+
+	struct FScope
+	{
+		explicit FScope(int32 InStage)
+			: Stage(bEnabled ? InStage : INDEX_NONE)
+			, StartTime(Stage != INDEX_NONE ? FPlatformTime::Seconds() : 0.0)
+		{
+		}
+
+		~FScope()
+		{
+			if (Stage != INDEX_NONE)
+			{
+				Seconds[Stage] += FPlatformTime::Seconds() - StartTime;
+			}
+		}
+
+		const int32 Stage;
+		const double StartTime;
+	};
+
+private:
+	static bool bEnabled;
+	static int32 NumStages;
+	static const TCHAR* Names[MaxStages];
+	static double Seconds[MaxStages];
+};
+
+/**
+ * Times a top-level AI stage: CSV column of its own, summed into the frame's SoulstrikeAI/FrameTotal
+ * column, and recorded for the benchmark
+ */
+#define SOULSTRIKE_AI_STAGE(StageName) \
+	CSV_SCOPED_TIMING_STAT(SoulstrikeAI, StageName); \
+	CSV_SCOPED_TIMING_STAT(SoulstrikeAI, FrameTotal); \
+	static const int32 PREPROCESSOR_JOIN(SoulstrikeStageIndex_, __LINE__) = FSoulstrikeStageTimings::Register(TEXT(#StageName)); \
+	const FSoulstrikeStageTimings::FScope PREPROCESSOR_JOIN(SoulstrikeStageScope_, __LINE__)(PREPROCESSOR_JOIN(SoulstrikeStageIndex_, __LINE__))
+
+// ========== SIGNIFICANCE TIERS ==========
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Elite RL Step (High)"), STAT_SoulstrikeAI_StepHigh, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Elite RL Step (Medium)"), STAT_SoulstrikeAI_StepMedium, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Elite RL Step (Low)"), STAT_SoulstrikeAI_StepLow, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Significance Update"), STAT_SoulstrikeAI_Significance, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Elites (High)"), STAT_SoulstrikeAI_ElitesHigh, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Elites (Medium)"), STAT_SoulstrikeAI_ElitesMedium, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Elites (Low)"), STAT_SoulstrikeAI_ElitesLow, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Live Elites"), STAT_SoulstrikeAI_LiveElites, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+// ========== RL SCHEDULER ==========
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RL Scheduler"), STAT_SoulstrikeAI_RLScheduler, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RL Phase: Begin Steps"), STAT_SoulstrikeAI_PhaseBegin, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RL Phase: Build States"), STAT_SoulstrikeAI_PhaseBuildStates, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RL Phase: Rewards"), STAT_SoulstrikeAI_PhaseRewards, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RL Phase: Inference"), STAT_SoulstrikeAI_PhaseInference, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("RL Phase: Apply Actions"), STAT_SoulstrikeAI_PhaseApply, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("RL Steps"), STAT_SoulstrikeAI_RLSteps, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("RL Steps Deferred"), STAT_SoulstrikeAI_RLStepsDeferred, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("RL Decisions"), STAT_SoulstrikeAI_RLDecisions, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+// ========== STATUS EFFECTS ==========
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Status Effects"), STAT_SoulstrikeAI_StatusEffects, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Active Status Effects"), STAT_SoulstrikeAI_ActiveStatusEffects, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+// ========== COMBAT EVENTS ==========
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Combat Event Delivery"), STAT_SoulstrikeAI_CombatEvents, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Combat Events Queued"), STAT_SoulstrikeAI_CombatEventsQueued, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+// ========== COMBAT TIMELINE ==========
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Combat Timeline"), STAT_SoulstrikeAI_CombatTimeline, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Pending Windups"), STAT_SoulstrikeAI_PendingWindups, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+// ========== ELITE STAGES ==========
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("World Snapshot"), STAT_SoulstrikeAI_WorldSnapshot, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("BuildState"), STAT_SoulstrikeAI_BuildState, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("FindClosestAllies"), STAT_SoulstrikeAI_FindClosestAllies, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HasLineOfSightToPlayer"), STAT_SoulstrikeAI_LineOfSight, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("SelectAction"), STAT_SoulstrikeAI_SelectAction, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("UpdateWeights"), STAT_SoulstrikeAI_UpdateWeights, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("EvaluateReward (single)"), STAT_SoulstrikeAI_EvaluateReward, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("ExecuteAction"), STAT_SoulstrikeAI_ExecuteAction, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Path Requests"), STAT_SoulstrikeAI_PathRequests, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Moves Coalesced"), STAT_SoulstrikeAI_MovesCoalesced, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Move Goal Cache Hits"), STAT_SoulstrikeAI_MoveGoalCacheHits, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Move Paths Failed"), STAT_SoulstrikeAI_MovePathsFailed, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+// ========== TRACES ==========
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("LOS Traces Issued"), STAT_SoulstrikeAI_TracesIssued, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Swarm Traces"), STAT_SoulstrikeAI_SwarmTraces, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+// ========== SWARM ==========
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Swarm ProcessMovement"), STAT_SoulstrikeAI_SwarmMovement, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Swarm ProcessAttack"), STAT_SoulstrikeAI_SwarmAttack, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Swarm Members"), STAT_SoulstrikeAI_SwarmMembers, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+
+// ========== DIRECTOR ==========
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("TickDirector"), STAT_SoulstrikeAI_TickDirector, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Spawn::SpawnActor"), STAT_SoulstrikeAI_SpawnActor, STATGROUP_SoulstrikeAI, SOULSTRIKE_API);
@@ -0,0 +1,23 @@
+#include "SoulstrikeTickableWorldSubsystem.h"
+#include "Engine/World.h"
+
+bool USoulstrikeTickableWorldSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	if (!Super::ShouldCreateSubsystem(Outer))
+		return false;
+
+	// Editor preview worlds have no player or elites to serve
+	const UWorld* World = Cast<UWorld>(Outer);
+	return World && World->IsGameWorld();
+}
+
+TStatId USoulstrikeTickableWorldSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USoulstrikeTickableWorldSubsystem, STATGROUP_Tickables);
+}
+
+ETickableTickType USoulstrikeTickableWorldSubsystem::GetTickableTickType() const
+{
+	// The CDO is registered as a tickable too - never tick it
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Always;
+}
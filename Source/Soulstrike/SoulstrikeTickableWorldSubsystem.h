@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "SoulstrikeTickableWorldSubsystem.generated.h"
+
+/**
+ * Base for per-world AI services that need a frame tick.
+ * Only created for game worlds; ticks once per frame after all actors have ticked.
+ */
+UCLASS(Abstract)
+class SOULSTRIKE_API USoulstrikeTickableWorldSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// ========== FTickableGameObject ==========
+
+	virtual void Tick(float DeltaTime) override {}
+	virtual TStatId GetStatId() const override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual UWorld* GetTickableGameObjectWorld() const override { return GetWorld(); }
+};
@@ -0,0 +1,84 @@
+#include "SoulstrikeTrace.h"
+
+#if SOULSTRIKE_AI_TRACE_ENABLED
+
+#include "HAL/PlatformTime.h"
+
+UE_TRACE_CHANNEL_DEFINE(SoulstrikeAIChannel);
+
+UE_TRACE_EVENT_BEGIN(SoulstrikeAI, EliteStepBegin)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, EliteId)
+	UE_TRACE_EVENT_FIELD(uint8, EliteType)
+	UE_TRACE_EVENT_FIELD(uint8, Significance)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SoulstrikeAI, EliteStepEnd)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, EliteId)
+	UE_TRACE_EVENT_FIELD(uint8, Action)
+	UE_TRACE_EVENT_FIELD(float, Reward)
+	UE_TRACE_EVENT_FIELD(bool, Decided)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SoulstrikeAI, DirectorSpawn)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint8, Decision)
+	UE_TRACE_EVENT_FIELD(int32, Count)
+	UE_TRACE_EVENT_FIELD(int32, CreditsLeft)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(SoulstrikeAI, SwarmPackRegistered)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, PackIdA)
+	UE_TRACE_EVENT_FIELD(uint32, PackIdB)
+	UE_TRACE_EVENT_FIELD(uint32, PackIdC)
+	UE_TRACE_EVENT_FIELD(uint32, PackIdD)
+	UE_TRACE_EVENT_FIELD(uint32, MemberId)
+	UE_TRACE_EVENT_FIELD(int32, PackSize)
+UE_TRACE_EVENT_END()
+
+namespace SoulstrikeTrace
+{
+	void EliteStepBegin(uint32 EliteId, uint8 EliteType, uint8 Significance)
+	{
+		UE_TRACE_LOG(SoulstrikeAI, EliteStepBegin, SoulstrikeAIChannel)
+			<< EliteStepBegin.Cycle(FPlatformTime::Cycles64())
+			<< EliteStepBegin.EliteId(EliteId)
+			<< EliteStepBegin.EliteType(EliteType)
+			<< EliteStepBegin.Significance(Significance);
+	}
+
+	void EliteStepEnd(uint32 EliteId, uint8 Action, float Reward, bool bDecided)
+	{
+		UE_TRACE_LOG(SoulstrikeAI, EliteStepEnd, SoulstrikeAIChannel)
+			<< EliteStepEnd.Cycle(FPlatformTime::Cycles64())
+			<< EliteStepEnd.EliteId(EliteId)
+			<< EliteStepEnd.Action(Action)
+			<< EliteStepEnd.Reward(Reward)
+			<< EliteStepEnd.Decided(bDecided);
+	}
+
+	void DirectorSpawn(ESoulstrikeSpawnDecision Decision, int32 Count, int32 CreditsLeft)
+	{
+		UE_TRACE_LOG(SoulstrikeAI, DirectorSpawn, SoulstrikeAIChannel)
+			<< DirectorSpawn.Cycle(FPlatformTime::Cycles64())
+			<< DirectorSpawn.Decision(static_cast<uint8>(Decision))
+			<< DirectorSpawn.Count(Count)
+			<< DirectorSpawn.CreditsLeft(CreditsLeft);
+	}
+
+	void SwarmPackRegistered(const FGuid& PackId, uint32 MemberId, int32 PackSize)
+	{
+		UE_TRACE_LOG(SoulstrikeAI, SwarmPackRegistered, SoulstrikeAIChannel)
+			<< SwarmPackRegistered.Cycle(FPlatformTime::Cycles64())
+			<< SwarmPackRegistered.PackIdA(PackId.A)
+			<< SwarmPackRegistered.PackIdB(PackId.B)
+			<< SwarmPackRegistered.PackIdC(PackId.C)
+			<< SwarmPackRegistered.PackIdD(PackId.D)
+			<< SwarmPackRegistered.MemberId(MemberId)
+			<< SwarmPackRegistered.PackSize(PackSize);
+	}
+}
+
+#endif
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+/**
+ * Soulstrike AI trace channel for Unreal Insights (-trace=cpu,SoulstrikeAI).
+ * CPU scopes land on the channel and typed events mark elite RL steps, Director spawn decisions
+ * and swarm pack registrations, so a frame spike can be matched to the elite or decision behind it.
+ * Everything here compiles to nothing when SOULSTRIKE_AI_TRACE_ENABLED is 0 (default in Shipping).
+ */
+#ifndef SOULSTRIKE_AI_TRACE_ENABLED
+	#define SOULSTRIKE_AI_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+#endif
+
+/** What the Director did on a spawn attempt */
+enum class ESoulstrikeSpawnDecision : uint8
+{
+	Skipped,	// Spawn roll failed
+	Swarm,
+	Elite
+};
+
+#if SOULSTRIKE_AI_TRACE_ENABLED
+
+UE_TRACE_CHANNEL_EXTERN(SoulstrikeAIChannel, SOULSTRIKE_API);
+
+namespace SoulstrikeTrace
+{
+	/** An elite's RL step started (EliteType / Significance are the enum values) */
+	SOULSTRIKE_API void EliteStepBegin(uint32 EliteId, uint8 EliteType, uint8 Significance);
+
+	/** An elite's RL step ended; bDecided is false when the step kept its last decision or was skipped (attack windup) */
+	SOULSTRIKE_API void EliteStepEnd(uint32 EliteId, uint8 Action, float Reward, bool bDecided);
+
+	/** Director spawn attempt: what it chose, how many enemies and the credits left afterwards */
+	SOULSTRIKE_API void DirectorSpawn(ESoulstrikeSpawnDecision Decision, int32 Count, int32 CreditsLeft);
+
+	/** A swarm member joined a pack */
+	SOULSTRIKE_API void SwarmPackRegistered(const FGuid& PackId, uint32 MemberId, int32 PackSize);
+}
+
+/** CPU scope on the Soulstrike AI channel */
+#define SOULSTRIKE_TRACE_SCOPE(Name) TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(Name, SoulstrikeAIChannel)
+
+/** Emit a typed event (arguments are only evaluated while the channel is enabled) */
+#define SOULSTRIKE_TRACE_EVENT(EventFunction, ...) \
+	do \
+	{ \
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(SoulstrikeAIChannel)) \
+		{ \
+			SoulstrikeTrace::EventFunction(__VA_ARGS__); \
+		} \
+	} while (0)
+
+#else
+
+#define SOULSTRIKE_TRACE_SCOPE(Name)
+#define SOULSTRIKE_TRACE_EVENT(EventFunction, ...) do {} while (0)
+
+#endif
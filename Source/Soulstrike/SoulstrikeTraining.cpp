@@ -0,0 +1,210 @@
+#include "SoulstrikeTraining.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeGameInstance.h"
+#include "CharacterBase.h"
+#include "Director.h"
+#include "Containers/Ticker.h"
+#include "Engine/GameViewportClient.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+
+static FAutoConsoleCommandWithWorld GSoulstrikeTrainingStatsCommand(
+	TEXT("Soulstrike.AI.Training.Stats"),
+	TEXT("Print simulated time, achieved speed and player bot counters of the training run."),
+	FConsoleCommandWithWorldDelegate::CreateStatic(&USoulstrikeTraining::DumpStats));
+
+namespace SoulstrikeTraining
+{
+	/** Simulated seconds between progress lines in the log */
+	const double ReportInterval = 60.0;
+}
+
+USoulstrikeTraining* USoulstrikeTraining::Get(const UWorld* World)
+{
+	return World ? World->GetSubsystem<USoulstrikeTraining>() : nullptr;
+}
+
+void USoulstrikeTraining::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	if (!FParse::Param(CommandLine, TEXT("SoulstrikeTrain")))
+		return;
+
+	FParse::Value(CommandLine, TEXT("TrainStep="), StepSeconds);
+	FParse::Value(CommandLine, TEXT("TrainSpeed="), MaxSpeed);
+	FParse::Value(CommandLine, TEXT("TrainMinutes="), SimulatedMinutes);
+	FParse::Value(CommandLine, TEXT("TrainSeed="), Seed);
+	FParse::Value(CommandLine, TEXT("TrainWorlds="), NumWorlds);
+	bBotDirector = !FParse::Param(CommandLine, TEXT("TrainShippingDirector"));
+
+	StepSeconds = FMath::Clamp(StepSeconds, 0.005f, 0.1f);
+	MaxSpeed = FMath::Max(0.0f, MaxSpeed);
+
+	// Every frame advances the world by one step, however long it took
+	FApp::SetUseFixedTimeStep(true);
+	FApp::SetFixedDeltaTime(StepSeconds);
+
+	// Learned transitions are the point of the run
+	if (IConsoleVariable* RecordVar = IConsoleManager::Get().FindConsoleVariable(TEXT("Soulstrike.AI.Trajectory.Record")))
+	{
+		RecordVar->Set(1, ECVF_SetByCode);
+	}
+
+	Phase = EPhase::WaitingForPlayer;
+
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("SoulstrikeTraining: %.4f s fixed step, speed %s, %s Director, seed %d, %d world(s)"),
+		StepSeconds, MaxSpeed > 0.0f ? *FString::Printf(TEXT("capped at %gx"), MaxSpeed) : TEXT("uncapped"),
+		bBotDirector ? TEXT("bot") : TEXT("shipping"), Seed, NumWorlds);
+}
+
+TStatId USoulstrikeTraining::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USoulstrikeTraining, STATGROUP_Tickables);
+}
+
+void USoulstrikeTraining::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	switch (Phase)
+	{
+	case EPhase::Idle:
+		return;
+
+	case EPhase::WaitingForPlayer:
+		if (GetWorld()->HasBegunPlay() && UGameplayStatics::GetPlayerCharacter(GetWorld(), 0))
+		{
+			BeginRun();
+		}
+		return;
+
+	case EPhase::Running:
+		Bot.Tick(DeltaTime);
+		SimulatedSeconds += DeltaTime;
+
+		if (SimulatedSeconds >= NextReportTime)
+		{
+			NextReportTime += SoulstrikeTraining::ReportInterval;
+			LogProgress();
+
+			if (Bot.GetShotsHit() == 0)
+			{
+				UE_LOG(LogSoulstrikeAI, Warning, TEXT("SoulstrikeTraining: player bot has not hit an elite in %.0f s - are elites spawning with an archetype?"), SimulatedSeconds);
+			}
+		}
+
+		if (SimulatedMinutes > 0.0f && SimulatedSeconds >= SimulatedMinutes * 60.0)
+		{
+			LogProgress();
+			Phase = EPhase::Idle;
+
+			// A run where the bot never landed a shot recorded no useful damage signal - fail it
+			if (Bot.GetShotsHit() == 0)
+			{
+				UE_LOG(LogSoulstrikeAI, Error, TEXT("SoulstrikeTraining: player bot never hit an elite"));
+				FPlatformMisc::RequestExitWithStatus(false, 1);
+				return;
+			}
+
+			RequestEngineExit(TEXT("Soulstrike training complete"));
+			return;
+		}
+
+		ThrottleToSpeed();
+		return;
+	}
+}
+
+void USoulstrikeTraining::BeginRun()
+{
+	UWorld* World = GetWorld();
+
+	ACharacterBase* Player = Cast<ACharacterBase>(UGameplayStatics::GetPlayerCharacter(World, 0));
+	if (!Player)
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("SoulstrikeTraining: player is not an ACharacterBase, training not started"));
+		Phase = EPhase::Idle;
+		return;
+	}
+
+	USoulstrikeGameInstance* GameInstance = Cast<USoulstrikeGameInstance>(World->GetGameInstance());
+	const int32 WorldIndex = GameInstance ? GameInstance->GetSimWorldIndex(World) : 0;
+
+	// Different choices per world, same choices per world across runs
+	FSoulstrikePlayerBot::FSettings BotSettings;
+	Bot.Start(Player, BotSettings, Seed + WorldIndex);
+
+	// The world the game started in brings up the others - from the core ticker, outside any world's tick
+	if (WorldIndex == 0 && NumWorlds > 1 && GameInstance)
+	{
+		TWeakObjectPtr<USoulstrikeGameInstance> WeakGameInstance(GameInstance);
+		TWeakObjectPtr<UWorld> WeakWorld(World);
+		const int32 NumSimWorlds = NumWorlds - 1;
+		FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda([WeakGameInstance, WeakWorld, NumSimWorlds](float)
+		{
+			if (WeakGameInstance.IsValid() && WeakWorld.IsValid())
+			{
+				WeakGameInstance->StartSimWorlds(WeakWorld.Get(), NumSimWorlds);
+			}
+			return false;
+		}));
+	}
+
+	if (bBotDirector)
+	{
+		for (TActorIterator<ADirector> It(World); It; ++It)
+		{
+			It->ApplyConfig(FDirectorConfig::MakeBotTraining());
+		}
+	}
+
+	// With a GPU around (no -nullrhi) still skip drawing the world
+	if (UGameViewportClient* Viewport = World->GetGameViewport())
+	{
+		Viewport->bDisableWorldRendering = true;
+	}
+
+	SimulatedSeconds = 0.0;
+	NextReportTime = SoulstrikeTraining::ReportInterval;
+	WallStartTime = FPlatformTime::Seconds();
+	Phase = EPhase::Running;
+}
+
+void USoulstrikeTraining::ThrottleToSpeed()
+{
+	if (MaxSpeed <= 0.0f)
+		return;
+
+	const double Ahead = SimulatedSeconds / MaxSpeed - (FPlatformTime::Seconds() - WallStartTime);
+	if (Ahead > 0.0)
+	{
+		FPlatformProcess::Sleep(static_cast<float>(FMath::Min(Ahead, 0.1)));
+	}
+}
+
+void USoulstrikeTraining::LogProgress() const
+{
+	const double WallSeconds = FMath::Max(FPlatformTime::Seconds() - WallStartTime, 0.001);
+	UE_LOG(LogSoulstrikeAI, Display, TEXT("SoulstrikeTraining: %.0f s simulated in %.0f s (%.1fx) - bot %d deaths, %d dodges, %d/%d shots hit for %.0f damage"),
+		SimulatedSeconds, WallSeconds, SimulatedSeconds / WallSeconds,
+		Bot.GetDeaths(), Bot.GetDodges(), Bot.GetShotsHit(), Bot.GetShotsFired(), Bot.GetDamageDealt());
+}
+
+void USoulstrikeTraining::DumpStats(UWorld* World)
+{
+	USoulstrikeTraining* Training = Get(World);
+	if (!Training || Training->Phase != EPhase::Running)
+	{
+		UE_LOG(LogSoulstrikeAI, Display, TEXT("SoulstrikeTraining: not running (start with -SoulstrikeTrain)"));
+		return;
+	}
+
+	Training->LogProgress();
+}
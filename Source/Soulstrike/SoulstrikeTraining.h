@@ -0,0 +1,78 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SoulstrikeTickableWorldSubsystem.h"
+#include "SoulstrikePlayerBot.h"
+#include "SoulstrikeTraining.generated.h"
+
+/**
+ * Soulstrike Training - faster-than-real-time headless training on the real map.
+ * The engine runs on a fixed simulated step (-TrainStep=, default 1/30 s) without waiting on the
+ * wall clock, so a frame that costs a few milliseconds still advances the world by a full step:
+ * that is where the time dilation comes from, without stretching physics or AI steps. -TrainSpeed=
+ * caps the dilation (0 = as fast as the machine goes). The human is replaced by FSoulstrikePlayerBot,
+ * Directors switch to FDirectorConfig::MakeBotTraining pacing (-TrainShippingDirector keeps theirs)
+ * and elite transitions are recorded to disk for the EliteTrain commandlet.
+ *
+ * -TrainWorlds=N runs N copies of the map in the process (see USoulstrikeGameInstance::StartSimWorlds),
+ * each with its own training run, bot (seeded TrainSeed + world index) and trajectory file.
+ *
+ * Start from the command line (no GPU needed):
+ *   -SoulstrikeTrain -nullrhi [-TrainStep=0.0333] [-TrainSpeed=20] [-TrainMinutes=60] [-TrainSeed=1] [-TrainWorlds=4]
+ * TrainMinutes counts simulated minutes; the run quits once they have passed (0 = run until closed).
+ * A short run doubles as a smoke test: it exits with code 1 if the bot never hit an elite.
+ */
+UCLASS()
+class SOULSTRIKE_API USoulstrikeTraining : public USoulstrikeTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Get the training run for a world (null for non-game worlds) */
+	static USoulstrikeTraining* Get(const UWorld* World);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	bool IsTraining() const { return Phase != EPhase::Idle; }
+
+	/** Print run counters to the log (Soulstrike.AI.Training.Stats) */
+	static void DumpStats(UWorld* World);
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		WaitingForPlayer,
+		Running
+	};
+
+	/** Take over the player and the Directors once the map has begun play */
+	void BeginRun();
+
+	/** Sleep off whatever puts the run ahead of the speed cap */
+	void ThrottleToSpeed();
+
+	void LogProgress() const;
+
+	EPhase Phase = EPhase::Idle;
+
+	// ========== CONFIGURATION ==========
+
+	float StepSeconds = 1.0f / 30.0f;
+	float MaxSpeed = 0.0f;
+	float SimulatedMinutes = 0.0f;
+	int32 Seed = 1;
+	int32 NumWorlds = 1;
+	bool bBotDirector = true;
+
+	// ========== RUN STATE ==========
+
+	FSoulstrikePlayerBot Bot;
+
+	double SimulatedSeconds = 0.0;
+	double WallStartTime = 0.0;
+	double NextReportTime = 0.0;
+};
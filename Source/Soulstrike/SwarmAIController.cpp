@@ -1,11 +1,15 @@
 #include "SwarmAIController.h"
 #include <Engine.h>
 #include "Util/LoadBP.h"
-#include "EnemyLogicManager.h"
+#include "EliteCombatEventBus.h"
+#include "EliteCombatTimeline.h"
+#include "EliteAIClock.h"
+#include "SoulstrikeLog.h"
+#include "SoulstrikeStats.h"
+#include "SoulstrikeTrace.h"
+#include "EliteTraceScheduler.h"
 
 TMap<FGuid, TArray<TWeakObjectPtr<ACharacter>>> ASwarmAIController::SwarmMap;
-TMap<TWeakObjectPtr<ACharacter>, bool> ASwarmAIController::WindingUpMap;
-TMap<TWeakObjectPtr<ACharacter>, FTimerHandle> ASwarmAIController::ActiveWindupTimerMap;
 
 ASwarmAIController::ASwarmAIController()
 {
@@ -49,6 +53,7 @@ void ASwarmAIController::RegisterSwarmEnemy(APawn* InPawn, const FGuid& InSwarmI
 	if (PawnChar)
 	{
 		SwarmMap[InSwarmId].Add(PawnChar);
+		SOULSTRIKE_TRACE_EVENT(SwarmPackRegistered, InSwarmId, PawnChar->GetUniqueID(), SwarmMap[InSwarmId].Num());
 	}
 }
 
@@ -60,12 +65,40 @@ void ASwarmAIController::OnUnPossess()
 
 void ASwarmAIController::Tick(float DeltaTime)
 {
-	ProcessMovement(DeltaTime);
+	INC_DWORD_STAT(STAT_SoulstrikeAI_SwarmMembers);
+	CSV_CUSTOM_STAT(SoulstrikeAI, SwarmMembers, 1, ECsvCustomStatOp::Accumulate);
+
+	// Steering is recomputed on AI clock steps; frames in between keep moving along the
+	// blend of the last two steering directions
+	const UEliteAIClock* Clock = UEliteAIClock::Get(GetWorld());
+	if (!Clock || Clock->GetStepsThisFrame() > 0)
+	{
+		PreviousSteering = SteeringDirection;
+		UpdateSteering();
+	}
+
+	if (!bWindingUp)
+	{
+		const float Alpha = Clock ? Clock->GetInterpolationAlpha() : 1.0f;
+		const FVector MoveDirection = FMath::Lerp(PreviousSteering, SteeringDirection, Alpha).GetSafeNormal();
+		if (APawn* ControlledPawn = GetPawn())
+		{
+			ControlledPawn->AddMovementInput(MoveDirection, DeltaTime * 600.f);
+		}
+	}
+
 	Super::Tick(DeltaTime);
 }
 
-void ASwarmAIController::ProcessMovement(float DeltaTime)
+void ASwarmAIController::UpdateSteering()
 {
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_SwarmMovement);
+	SOULSTRIKE_AI_STAGE(SwarmMovement);
+	SOULSTRIKE_TRACE_SCOPE(SoulstrikeAI_SwarmMovement);
+
+	// Nothing to steer toward unless we get all the way through
+	SteeringDirection = FVector::ZeroVector;
+
 	UWorld* World = GetWorld();
 	ACharacter* Player = UGameplayStatics::GetPlayerCharacter(World, 0);
 	if (!Player) return;
@@ -103,7 +136,7 @@ void ASwarmAIController::ProcessMovement(float DeltaTime)
 
 	TWeakObjectPtr<ACharacter> Target = Cast<ACharacter>(GetPawn());
 	if (!Target.IsValid()) return;
-	if (WindingUpMap.Contains(Target) && WindingUpMap[Target])
+	if (bWindingUp)
 		return;
 
 
@@ -146,8 +179,7 @@ void ASwarmAIController::ProcessMovement(float DeltaTime)
 			+ ToPlayer * TargetWeight)
 		.GetSafeNormal();
 
-	// Apply movement
-	Target->AddMovementInput(DesiredDir, DeltaTime * 600.f);
+	SteeringDirection = DesiredDir;
 	
 	//DrawDebugLine(World, Target->GetActorLocation(), Target->GetActorLocation() + DesiredDir * 1000.f, FColor::Red, false, 0.1f, 0, 2.f);
 
@@ -161,6 +193,10 @@ void ASwarmAIController::ProcessMovement(float DeltaTime)
 
 	FHitResult Hit;
 	bool bBlocked = World->LineTraceSingleByChannel(Hit, Start, End, ECC_WorldStatic, Params);
+	if (UEliteTraceScheduler* TraceScheduler = UEliteTraceScheduler::Get(World))
+	{
+		TraceScheduler->NoteSwarmTrace();
+	}
 
 	if (bBlocked && Target->GetMovementComponent()->IsMovingOnGround())
 	{
@@ -170,6 +206,9 @@ void ASwarmAIController::ProcessMovement(float DeltaTime)
 
 void ASwarmAIController::ProcessAttack()
 {
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_SwarmAttack);
+	SOULSTRIKE_AI_STAGE(SwarmAttack);
+
 	TWeakObjectPtr<ACharacter> Enemy = Cast<ACharacter>(GetPawn());
 	if (!Enemy.IsValid()) return;
 
@@ -182,16 +221,14 @@ void ASwarmAIController::ProcessAttack()
 	float DistToPlayer = FVector::Dist(Enemy->GetActorLocation(), Player->GetActorLocation());
 	if (DistToPlayer > MaxAttackRange) return;
 
-	if (WindingUpMap.Contains(Enemy) && WindingUpMap[Enemy]) return;
+	if (bWindingUp) return;
 
-	WindingUpMap.Add(Enemy, true);
+	UEliteCombatTimeline* Timeline = UEliteCombatTimeline::Get(World);
+	if (!Timeline) return;
 
-	FTimerHandle& AttackTimerHandle = ActiveWindupTimerMap.FindOrAdd(Enemy);
-	FTimerDelegate AttackTimerDelegate;
-
-	AttackTimerDelegate.BindUObject(this, &ASwarmAIController::OnAttackWindupComplete, Player);
-
-	GetWorldTimerManager().SetTimer(AttackTimerHandle, AttackTimerDelegate, AttackWindupDuration, false);
+	bWindingUp = true;
+	Timeline->ScheduleWindup(Enemy.Get(), AttackWindupDuration, MaxAttackRange,
+		FOnAttackWindupResolved::CreateUObject(this, &ASwarmAIController::OnAttackWindupComplete));
 
 	if (UFunction* AttackStartFunc = Enemy->FindFunction(FName("OnAttackStart")))
 	{
@@ -202,38 +239,22 @@ void ASwarmAIController::ProcessAttack()
 	}
 }
 
-void ASwarmAIController::OnAttackWindupComplete(ACharacter* Target)
+void ASwarmAIController::OnAttackWindupComplete(const FAttackWindupResult& Result)
 {
-	if (!Target) return;
-
-	TWeakObjectPtr<ACharacter> Enemy = Cast<ACharacter>(GetPawn());
-	if (!Enemy.IsValid()) return;
-
-	UWorld* World = GetWorld();
-	if (!World) return;
-
 	// Clear windup flag
-	WindingUpMap.FindOrAdd(Enemy) = false;
+	bWindingUp = false;
 
-	// Clear timer
-	if (ActiveWindupTimerMap.Contains(Enemy))
-	{
-		GetWorldTimerManager().ClearTimer(ActiveWindupTimerMap[Enemy]);
-	}
+	TWeakObjectPtr<ACharacter> Enemy = Cast<ACharacter>(GetPawn());
+	if (!Enemy.IsValid() || !Result.Player) return;
 
-	float DistToPlayer = FVector::Dist(Enemy->GetActorLocation(), Target->GetActorLocation());
-	if (DistToPlayer > MaxAttackRange)
+	if (!Result.bInRange)
 	{
-#if UE_EDITOR
-		UE_LOG(LogTemp, Warning, TEXT("%s: Attack missed! Player dodged out of range during windup (%.1f/%.1f)"),
-			*Enemy->GetName(), DistToPlayer, MaxAttackRange);
-#endif
+		SOULSTRIKE_LOG_SUMMARY(LogSoulstrikeSwarm, Log, "Swarm attacks missed (player dodged)", 0.0f);
 		return;
 	}
-	AEnemyLogicManager* EnemyLogicMgr = Cast<AEnemyLogicManager>(UGameplayStatics::GetActorOfClass(World, AEnemyLogicManager::StaticClass()));
 
-	if (EnemyLogicMgr)
+	if (UEliteCombatEventBus* CombatEvents = UEliteCombatEventBus::Get(GetWorld()))
 	{
-		EnemyLogicMgr->ReportDamageToPlayer(Target, AttackDamage, Enemy.Get());
+		CombatEvents->PushDamage(Result.Player, AttackDamage, Enemy.Get());
 	}
-}
\ No newline at end of file
+}
@@ -4,6 +4,8 @@
 #include "AIController.h"
 #include "SwarmAIController.generated.h"
 
+struct FAttackWindupResult;
+
 /**
  * AI Controller for swarm enemies
  * Handles possession and basic AI logic for ASwarmEnemy
@@ -19,6 +21,9 @@ public:
 
 	void RegisterSwarmEnemy(APawn* InPawn, const FGuid& InSwarmId);
 
+	// Packs in the shared swarm map (for leak tracking in long captures)
+	static int32 GetNumTrackedSwarmPacks() { return SwarmMap.Num(); }
+
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
@@ -39,16 +44,18 @@ private:
 
 	FGuid SwarmId;
 
-	void ProcessMovement(float DeltaTime);
+	// Recompute SteeringDirection (boids) and jump over obstacles - once per AI clock step
+	void UpdateSteering();
 	void ProcessAttack();
-	void OnAttackWindupComplete(ACharacter* Target);
+	void OnAttackWindupComplete(const FAttackWindupResult& Result);
 	static TMap<FGuid, TArray<TWeakObjectPtr<ACharacter>>> SwarmMap;
 
-	// Tracks which enemies currently have a windup running
-	static TMap<TWeakObjectPtr<ACharacter>, bool> WindingUpMap;
+	// Whether our pawn has a windup waiting on the combat timeline
+	bool bWindingUp = false;
 
-	// Tracks each enemys active windup timer
-	static TMap<TWeakObjectPtr<ACharacter>, FTimerHandle> ActiveWindupTimerMap;
+	// Steering from the last two AI clock steps; movement blends between them every frame
+	FVector PreviousSteering = FVector::ZeroVector;
+	FVector SteeringDirection = FVector::ZeroVector;
 
 	const float SeparationDistance = 600.f;
 	const float CohesionWeight = 0.8f;
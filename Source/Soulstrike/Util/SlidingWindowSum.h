@@ -0,0 +1,97 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixed-capacity, time-bucketed sliding window sum.
+ * Samples are binned into NumBuckets buckets of (WindowSeconds / NumBuckets) each and a running
+ * sum is kept, so Add, Advance and GetSum are constant time and never allocate.
+ * Samples expire with bucket granularity; times passed in must be non-decreasing.
+ */
+template <int32 NumBuckets>
+class TSlidingWindowSum
+{
+	static_assert(NumBuckets > 0, "TSlidingWindowSum needs at least one bucket");
+
+public:
+	explicit TSlidingWindowSum(float InWindowSeconds)
+		: WindowSeconds(InWindowSeconds)
+		, BucketDuration(InWindowSeconds / NumBuckets)
+	{
+		Reset();
+	}
+
+	/** Drop all samples */
+	void Reset()
+	{
+		FMemory::Memzero(Buckets);
+		RunningSum = 0.0;
+		HeadBucket = 0;
+		HeadIndex = 0;
+		bHasHead = false;
+	}
+
+	/** Record a sample at Time (seconds) */
+	void Add(double Time, float Value)
+	{
+		Advance(Time);
+		Buckets[HeadIndex] += Value;
+		RunningSum += Value;
+	}
+
+	/** Expire everything that fell out of the window ending at Time */
+	void Advance(double Time)
+	{
+		const int64 Bucket = (int64)FMath::FloorToDouble(Time / BucketDuration);
+		if (!bHasHead)
+		{
+			HeadBucket = Bucket;
+			bHasHead = true;
+			return;
+		}
+
+		if (Bucket <= HeadBucket)
+			return;
+
+		// Bounded by NumBuckets no matter how long we were idle
+		const int64 Steps = FMath::Min<int64>(Bucket - HeadBucket, NumBuckets);
+		for (int64 i = 0; i < Steps; ++i)
+		{
+			HeadIndex = (HeadIndex + 1) % NumBuckets;
+			RunningSum -= Buckets[HeadIndex];
+			Buckets[HeadIndex] = 0.0f;
+		}
+		HeadBucket = Bucket;
+
+		// Whole window expired - also clears accumulated rounding error
+		if (Steps == NumBuckets)
+		{
+			RunningSum = 0.0;
+		}
+	}
+
+	/** Sum of all samples in the window */
+	float GetSum() const { return FMath::Max(0.0f, (float)RunningSum); }
+
+	/** Sum divided by the window length (e.g. damage per second) */
+	float GetRate() const { return GetSum() / WindowSeconds; }
+
+	float GetWindowSeconds() const { return WindowSeconds; }
+
+private:
+	float Buckets[NumBuckets];
+
+	/** Kept in double so add/expire pairs don't drift over long sessions */
+	double RunningSum;
+
+	/** Absolute bucket number (Time / BucketDuration) of the newest bucket */
+	int64 HeadBucket;
+
+	/** Ring slot of the newest bucket */
+	int32 HeadIndex;
+
+	bool bHasHead;
+
+	float WindowSeconds;
+	float BucketDuration;
+};
@@ -2,6 +2,7 @@
 
 
 #include "Spawn.h"
+#include "SoulstrikeStats.h"
 
 AActor* Spawn::SpawnActor(UWorld* World, UClass* Class, const FVector Origin, const FVector Extent, const float MinDistanceFromOrigin, const float MaxSlopeAngle, const bool Rotate, const FActorSpawnParameters& SpawnParams)
 {
@@ -10,6 +11,8 @@ AActor* Spawn::SpawnActor(UWorld* World, UClass* Class, const FVector Origin, co
 
 AActor* Spawn::SpawnActor(UWorld* World, UClass* Class, const FVector Origin, const FVector Extent, const float MinDistanceFromOrigin, const float MaxSlopeAngle, const bool Rotate, const FActorSpawnParameters& SpawnParams, FVector SpawnOffset)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SoulstrikeAI_SpawnActor);
+
 	FRotator SpawnRotation;
 	FVector SpawnLocation = GetGroundLocationAndNormal(World, Origin, Extent, MinDistanceFromOrigin, MaxSlopeAngle, SpawnRotation);
 
@@ -1,4 +1,16 @@
 #include "WeightManager.h"
+#include "SoulstrikeLog.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace EliteWeightCheckpoint
+{
+	const uint32 Magic = 0x54575353; // "SSWT"
+	const int32 Version = 1;
+}
 
 UWeightManager* UWeightManager::Instance = nullptr;
 
@@ -8,7 +20,14 @@ UWeightManager* UWeightManager::Get(UWorld* World)
 	{
 		Instance = NewObject<UWeightManager>();
 		Instance->AddToRoot(); // Prevent garbage collection
-		UE_LOG(LogTemp, Log, TEXT("WeightManager: Singleton instance created."));
+		UE_LOG(LogSoulstrikeAI, Log, TEXT("WeightManager: Singleton instance created."));
+
+		// Start from trained brains instead of the biased defaults
+		FString CheckpointFilename;
+		if (FParse::Value(FCommandLine::Get(), TEXT("SoulstrikeBrains="), CheckpointFilename))
+		{
+			Instance->LoadCheckpoint(CheckpointFilename);
+		}
 	}
 	return Instance;
 }
@@ -22,18 +41,152 @@ TMap<EEliteAction, TMap<FName, float>> UWeightManager::LoadWeights(EEliteType Ty
 {
 	if (StoredWeights.Contains(Type))
 	{
-		UE_LOG(LogTemp, Log, TEXT("WeightManager: Loading weights for elite type %d (learned from previous souls)"), (int32)Type);
+		UE_LOG(LogSoulstrikeAI, Log, TEXT("WeightManager: Loading weights for elite type %d (learned from previous souls)"), (int32)Type);
 		return StoredWeights[Type];
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("WeightManager: No weights found for elite type %d (first spawn)"), (int32)Type);
+	UE_LOG(LogSoulstrikeAI, Warning, TEXT("WeightManager: No weights found for elite type %d (first spawn)"), (int32)Type);
 	return TMap<EEliteAction, TMap<FName, float>>();
 }
 
 void UWeightManager::SaveWeights(EEliteType Type, const TMap<EEliteAction, TMap<FName, float>>& Weights)
 {
 	StoredWeights.Add(Type, Weights);
-	UE_LOG(LogTemp, Log, TEXT("WeightManager: Saved weights for elite type %d (soul preserved)"), (int32)Type);
+	UE_LOG(LogSoulstrikeAI, Log, TEXT("WeightManager: Saved weights for elite type %d (soul preserved)"), (int32)Type);
+}
+
+void UWeightManager::MergeWeights(EEliteType Type, const TMap<EEliteAction, TMap<FName, float>>& Weights, const TMap<EEliteAction, TMap<FName, float>>& BaseWeights)
+{
+	TMap<EEliteAction, TMap<FName, float>>* Stored = StoredWeights.Find(Type);
+	if (!Stored)
+	{
+		SaveWeights(Type, Weights);
+		return;
+	}
+
+	for (const auto& ActionPair : Weights)
+	{
+		const TMap<FName, float>* BaseFeatures = BaseWeights.Find(ActionPair.Key);
+		TMap<FName, float>& StoredFeatures = Stored->FindOrAdd(ActionPair.Key);
+
+		for (const auto& FeaturePair : ActionPair.Value)
+		{
+			const float* BaseValue = BaseFeatures ? BaseFeatures->Find(FeaturePair.Key) : nullptr;
+			float* StoredValue = StoredFeatures.Find(FeaturePair.Key);
+
+			// A feature the store has never seen is taken as is
+			if (!StoredValue)
+			{
+				StoredFeatures.Add(FeaturePair.Key, FeaturePair.Value);
+				continue;
+			}
+
+			*StoredValue += FeaturePair.Value - (BaseValue ? *BaseValue : *StoredValue);
+		}
+	}
+
+	UE_LOG(LogSoulstrikeAI, Log, TEXT("WeightManager: Merged learned weights for elite type %d (soul preserved)"), (int32)Type);
+}
+
+bool UWeightManager::SaveCheckpoint(const FString& Filename) const
+{
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+
+	uint32 Magic = EliteWeightCheckpoint::Magic;
+	int32 Version = EliteWeightCheckpoint::Version;
+	int32 NumTypes = StoredWeights.Num();
+	Writer << Magic << Version << NumTypes;
+
+	// Feature names go out as strings: FName serialization needs a name table
+	for (const auto& TypePair : StoredWeights)
+	{
+		uint8 Type = static_cast<uint8>(TypePair.Key);
+		int32 NumActions = TypePair.Value.Num();
+		Writer << Type << NumActions;
+
+		for (const auto& ActionPair : TypePair.Value)
+		{
+			uint8 Action = static_cast<uint8>(ActionPair.Key);
+			int32 NumFeatures = ActionPair.Value.Num();
+			Writer << Action << NumFeatures;
+
+			for (const auto& FeaturePair : ActionPair.Value)
+			{
+				FString FeatureName = FeaturePair.Key.ToString();
+				float Weight = FeaturePair.Value;
+				Writer << FeatureName << Weight;
+			}
+		}
+	}
+
+	if (!FFileHelper::SaveArrayToFile(Bytes, *Filename))
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("WeightManager: Could not write checkpoint %s"), *Filename);
+		return false;
+	}
+
+	UE_LOG(LogSoulstrikeAI, Log, TEXT("WeightManager: Saved checkpoint with %d elite type(s) to %s"), NumTypes, *Filename);
+	return true;
+}
+
+bool UWeightManager::LoadCheckpoint(const FString& Filename)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Filename))
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("WeightManager: Could not read checkpoint %s"), *Filename);
+		return false;
+	}
+
+	FMemoryReader Reader(Bytes);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	int32 NumTypes = 0;
+	Reader << Magic << Version << NumTypes;
+
+	if (Magic != EliteWeightCheckpoint::Magic || Version != EliteWeightCheckpoint::Version)
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("WeightManager: %s is not a version %d weight checkpoint"), *Filename, EliteWeightCheckpoint::Version);
+		return false;
+	}
+
+	// Parse everything before touching the stored weights so a truncated file changes nothing
+	TMap<EEliteType, TMap<EEliteAction, TMap<FName, float>>> LoadedWeights;
+	for (int32 TypeIndex = 0; TypeIndex < NumTypes && !Reader.IsError(); ++TypeIndex)
+	{
+		uint8 Type = 0;
+		int32 NumActions = 0;
+		Reader << Type << NumActions;
+
+		TMap<EEliteAction, TMap<FName, float>>& TypeWeights = LoadedWeights.Add(static_cast<EEliteType>(Type));
+		for (int32 ActionIndex = 0; ActionIndex < NumActions && !Reader.IsError(); ++ActionIndex)
+		{
+			uint8 Action = 0;
+			int32 NumFeatures = 0;
+			Reader << Action << NumFeatures;
+
+			TMap<FName, float>& ActionWeights = TypeWeights.Add(static_cast<EEliteAction>(Action));
+			for (int32 FeatureIndex = 0; FeatureIndex < NumFeatures && !Reader.IsError(); ++FeatureIndex)
+			{
+				FString FeatureName;
+				float Weight = 0.0f;
+				Reader << FeatureName << Weight;
+				ActionWeights.Add(FName(*FeatureName), Weight);
+			}
+		}
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("WeightManager: Checkpoint %s is truncated, ignoring it"), *Filename);
+		return false;
+	}
+
+	StoredWeights.Append(MoveTemp(LoadedWeights));
+	UE_LOG(LogSoulstrikeAI, Log, TEXT("WeightManager: Loaded %d elite type(s) from checkpoint %s"), NumTypes, *Filename);
+	return true;
 }
 
 void UWeightManager::ResetAllWeights()
@@ -43,10 +196,10 @@ void UWeightManager::ResetAllWeights()
 	
 	if (NumTypesReset > 0)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("WeightManager: All Elite AI weights reset! Cleared learned knowledge from %d elite type(s). Elites will start fresh."), NumTypesReset);
+		UE_LOG(LogSoulstrikeAI, Warning, TEXT("WeightManager: All Elite AI weights reset! Cleared learned knowledge from %d elite type(s). Elites will start fresh."), NumTypesReset);
 	}
 	else
 	{
-		UE_LOG(LogTemp, Log, TEXT("WeightManager: Weight reset called (no learned weights to clear)."));
+		UE_LOG(LogSoulstrikeAI, Log, TEXT("WeightManager: Weight reset called (no learned weights to clear)."));
 	}
 }
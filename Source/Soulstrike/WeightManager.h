@@ -40,6 +40,22 @@ public:
 	/** Save weights for a given elite type */
 	void SaveWeights(EEliteType Type, const TMap<EEliteAction, TMap<FName, float>>& Weights);
 
+	/**
+	 * Fold one elite's learning into the stored weights: Stored += Weights - BaseWeights, where
+	 * BaseWeights are what the elite loaded at spawn. Used while simulation worlds run in parallel, so
+	 * elites of the same type learning at the same time in different worlds all contribute instead of
+	 * the last one to die winning. A normal game keeps SaveWeights.
+	 */
+	void MergeWeights(EEliteType Type, const TMap<EEliteAction, TMap<FName, float>>& Weights, const TMap<EEliteAction, TMap<FName, float>>& BaseWeights);
+
+	/**
+	 * Write every stored elite type to a checkpoint file, or overwrite the stored weights of every
+	 * type in a checkpoint; other types are kept. The game loads -SoulstrikeBrains=<file> when the
+	 * manager is created; the EliteTrain commandlet writes them.
+	 */
+	bool SaveCheckpoint(const FString& Filename) const;
+	bool LoadCheckpoint(const FString& Filename);
+
 	/** Reset all weights (for debugging/testing) */
 	UFUNCTION(BlueprintCallable, Category = "RL|Debug")
 	void ResetAllWeights();